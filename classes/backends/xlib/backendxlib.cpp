@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2022 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -13,6 +13,7 @@
 #include <smooth/backends/xlib/backendxlib.h>
 #include <smooth/files/file.h>
 #include <smooth/io/instream.h>
+#include <smooth/misc/stringview.h>
 #include <smooth/system/system.h>
 #include <smooth/foreach.h>
 
@@ -72,12 +73,16 @@ static GdkRGBA get_gtk_color(GType type, const gchar *className, GtkStateFlags s
 
 static S::GUI::Color get_kde_color(const S::String &category, const S::String &color)
 {
-	S::String			 spec	= S::Backends::BackendXLib::QueryKDESettings(S::String("Colors:").Append(category), color);
-	const S::Array<S::String>	&values = spec.Explode(",");
+	S::String		 spec	= S::Backends::BackendXLib::QueryKDESettings(S::String("Colors:").Append(category), color);
+	S::StringTokenizer	 values(spec, ",");
+	S::StringView		 value[4];
+	S::Int			 count	= 0;
 
-	if (values.Length() != 3) return S::GUI::Color();
+	while (count < 4 && values.Next(value[count])) count++;
 
-	return S::GUI::Color(values.GetNth(0).ToInt(), values.GetNth(1).ToInt(), values.GetNth(2).ToInt());
+	if (count != 3) return S::GUI::Color();
+
+	return S::GUI::Color(value[0].ToInt(), value[1].ToInt(), value[2].ToInt());
 }
 
 S::Backends::Backend *CreateBackendXLib()
@@ -155,12 +160,14 @@ S::Void S::Backends::BackendXLib::UpdateColors()
 {
 	/* Check desktop environment.
 	 */
-	String			 desktop = getenv("XDG_CURRENT_DESKTOP");
-	const Array<String>	&IDs	 = desktop.Explode(":");
+	String		 desktop = getenv("XDG_CURRENT_DESKTOP");
+	String		 kde	 = "KDE";
+	StringTokenizer	 IDs(desktop, ":");
+	StringView	 ID;
 
-	foreach (const String &ID, IDs)
+	while (IDs.Next(ID))
 	{
-		if (ID == "KDE" && UpdateColorsKDE()) return;
+		if (ID == kde && UpdateColorsKDE()) return;
 	}
 
 	UpdateColorsGnome();
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2022 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -15,6 +15,7 @@
 #endif
 
 #include <smooth/files/directory.h>
+#include <smooth/misc/stringbuilder.h>
 
 #ifdef __WIN32__
 #	include <smooth/backends/win32/backendwin32.h>
@@ -50,6 +51,36 @@ static const S::String	 kDotsElement = S::String(kDelimiter).Append(kDots).Appen
 
 char	*S::Directory::directoryDelimiter = NIL;
 
+#ifndef __WIN32__
+static inline S::Bool IsGlobSpecial(wchar_t c)
+{
+	return c == '*' || c == '?' || c == '[' || c == ']';
+}
+
+/* Escape glob special characters in a single pass.
+ */
+static S::String EscapeGlobPattern(const S::String &path)
+{
+	S::Int	 length	  = path.Length();
+	S::Int	 specials = 0;
+
+	for (S::Int i = 0; i < length; i++) if (IsGlobSpecial(path[i])) specials++;
+
+	if (specials == 0) return path;
+
+	S::StringBuilder	 builder(length + specials);
+
+	for (S::Int i = 0; i < length; i++)
+	{
+		if (IsGlobSpecial(path[i])) builder.AppendChar('\\');
+
+		builder.AppendChar(path[i]);
+	}
+
+	return builder.Finish();
+}
+#endif
+
 S::Directory::Directory()
 {
 }
@@ -188,11 +219,10 @@ const S::Array<S::File> &S::Directory::GetFilesByPattern(const String &pattern)
 
 	FindClose(handle);
 #else
-	String	 path	  = String(*this).Replace("*", "\\*").Replace("?", "\\?").
-					  Replace("[", "\\[").Replace("]", "\\]");
+	String	 path	  = EscapeGlobPattern(*this);
 	glob_t	 fileData = { 0 };
 
-	if (glob(path.Append(kSlash).Append(pattern).ConvertTo("UTF-8"), GLOB_MARK, NIL, &fileData) == 0)
+	if (glob(String::ConvertedString(path.Append(kSlash).Append(pattern), "UTF-8"), GLOB_MARK, NIL, &fileData) == 0)
 	{
 		String::InputFormat	 inputFormat("UTF-8");
 
@@ -227,11 +257,10 @@ const S::Array<S::Directory> &S::Directory::GetDirectoriesByPattern(const String
 
 	FindClose(handle);
 #else
-	String	 path	  = String(*this).Replace("*", "\\*").Replace("?", "\\?").
-					  Replace("[", "\\[").Replace("]", "\\]");
+	String	 path	  = EscapeGlobPattern(*this);
 	glob_t	 fileData = { 0 };
 
-	if (glob(path.Append(kSlash).Append(pattern).ConvertTo("UTF-8"), GLOB_MARK | GLOB_ONLYDIR, NIL, &fileData) == 0)
+	if (glob(String::ConvertedString(path.Append(kSlash).Append(pattern), "UTF-8"), GLOB_MARK | GLOB_ONLYDIR, NIL, &fileData) == 0)
 	{
 		String::InputFormat	 inputFormat("UTF-8");
 
@@ -294,7 +323,7 @@ S::Bool S::Directory::Exists() const
 #else
 	struct stat	 info;
 
-	if (stat(String(*this).ConvertTo("UTF-8"), &info) != 0) return False;
+	if (stat(String::ConvertedString(String(*this), "UTF-8"), &info) != 0) return False;
 
 	if (!S_ISDIR(info.st_mode)) return False;
 #endif
@@ -318,8 +347,8 @@ S::Int S::Directory::Create()
 #ifdef __WIN32__
 			result = CreateDirectory(MakeExtendedPath(path), NIL);
 #else
-			if (mkdir(path.ConvertTo("UTF-8"), 0777) == 0) result = True;
-			else					       result = False;
+			if (mkdir(String::ConvertedString(path, "UTF-8"), 0777) == 0) result = True;
+			else							      result = False;
 #endif
 		}
 	}
@@ -340,7 +369,7 @@ S::Int S::Directory::Move(const Directory &destination)
 #ifdef __WIN32__
 	Bool	 result = MoveFile(MakeExtendedPath(*this), MakeExtendedPath(destination));
 #else
-	Bool	 result = (rename(String(*this).ConvertTo("UTF-8"), String(destination).ConvertTo("UTF-8")) == 0);
+	Bool	 result = (rename(String::ConvertedString(String(*this), "UTF-8"), String::ConvertedString(String(destination), "UTF-8")) == 0);
 #endif
 
 	if (result == False) return Error();
@@ -352,7 +381,7 @@ S::Int S::Directory::Delete()
 #ifdef __WIN32__
 	Bool	 result = RemoveDirectory(MakeExtendedPath(*this));
 #else
-	Bool	 result = (rmdir(String(*this).ConvertTo("UTF-8")) == 0);
+	Bool	 result = (rmdir(String::ConvertedString(String(*this), "UTF-8")) == 0);
 #endif
 
 	if (result == False) return Error();
@@ -475,7 +504,7 @@ S::Int S::Directory::SetActiveDirectory(const Directory &directory)
 #ifdef __WIN32__
 	Bool	 result = SetCurrentDirectory(MakeExtendedPath(directory).Append(kBackslash));
 #else
-	Bool	 result = (chdir(String(directory).ConvertTo("UTF-8")) == 0);
+	Bool	 result = (chdir(String::ConvertedString(String(directory), "UTF-8")) == 0);
 #endif
 
 	if (result == False) return Error();
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2022 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -19,7 +19,7 @@
 #include <smooth/files/file.h>
 #include <smooth/misc/math.h>
 #include <smooth/misc/number.h>
-#include <smooth/foreach.h>
+#include <smooth/misc/stringview.h>
 
 using namespace X11;
 
@@ -519,21 +519,50 @@ S::Int S::GUI::SurfaceCairo::SetText(const String &string, const Rect &iRect, co
 
 	/* Draw text line by line.
 	 */
-	const Array<String>	&lines = string.Explode("\n");
+	Int	 newline = string.Find("\n");
 
-	if (lines.Length() > 1) lineHeight = font.GetScaledTextSizeY() + 3;
+	if (newline >= 0 && newline < string.Length() - 1) lineHeight = font.GetScaledTextSizeY() + 3;
 
-	foreach (const String &line, lines)
+	StringTokenizer	 lines(string, "\n");
+	StringView	 view;
+
+	/* Convert the whole text once and pass each line's part to
+	 * Pango followed by a space. Lines in the converted text are
+	 * separated by the same line feeds as in the original text.
+	 */
+	String::ConvertedString	 utf8(string, "UTF-8");
+
+	const char		*utf8Line = utf8;
+	Buffer<char>		 text(strlen(utf8) + 2);
+
+	while (lines.Next(view))
 	{
-		Int	 lineLength = line.Length();
+		const char	*utf8End    = strchr(utf8Line, '\n');
+		Int		 utf8Length = (utf8End != NIL ? utf8End - utf8Line : strlen(utf8Line));
+
+		const char	*line	    = utf8Line;
+
+		utf8Line += utf8Length + (utf8End != NIL ? 1 : 0);
 
-		if (lineLength == 0) { rect.top += lineHeight; continue; }
+		if (view.Length() == 0) { rect.top += lineHeight; continue; }
+
+		memcpy(text, line, utf8Length);
+
+		text[utf8Length]     = ' ';
+		text[utf8Length + 1] = 0;
 
 		Rect	 tRect = rightToLeft.TranslateRect(rect);
 
-		tRect.left = rightToLeft.GetRightToLeft() ? tRect.right - font.GetScaledTextSizeX(line) : tRect.left;
+		if (rightToLeft.GetRightToLeft())
+		{
+			int	 width = 0;
 
-		Int	 utf8Length = (line != NIL ? strlen(line.ConvertTo("UTF-8")) : 0);
+			pango_layout_set_attributes(paintLayout, NIL);
+			pango_layout_set_text(paintLayout, line, utf8Length);
+			pango_layout_get_pixel_size(paintLayout, &width, NIL);
+
+			tRect.left = tRect.right - width;
+		}
 
 		PangoAttrList	*attributes    = pango_attr_list_new();
 		PangoAttribute	*underline     = pango_attr_underline_new(font.GetStyle() & Font::Underline ? PANGO_UNDERLINE_SINGLE : PANGO_UNDERLINE_NONE);
@@ -549,7 +578,7 @@ S::Int S::GUI::SurfaceCairo::SetText(const String &string, const Rect &iRect, co
 		{
 			pango_layout_set_attributes(layout, attributes);
 
-			pango_layout_set_text(layout, String(line).Append(" ").ConvertTo("UTF-8"), -1);
+			pango_layout_set_text(layout, text, utf8Length + 1);
 
 			cairo_move_to(context, tRect.left, tRect.top);
 			pango_cairo_show_layout(context, layout);
@@ -557,7 +586,7 @@ S::Int S::GUI::SurfaceCairo::SetText(const String &string, const Rect &iRect, co
 
 		pango_layout_set_attributes(paintLayout, attributes);
 
-		pango_layout_set_text(paintLayout, String(line).Append(" ").ConvertTo("UTF-8"), -1);
+		pango_layout_set_text(paintLayout, text, utf8Length + 1);
 
 		cairo_move_to(paintContextCairo, tRect.left, tRect.top);
 		pango_cairo_show_layout(paintContextCairo, paintLayout);
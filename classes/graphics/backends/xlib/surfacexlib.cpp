@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2020 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -17,7 +17,7 @@
 #include <smooth/files/file.h>
 #include <smooth/misc/math.h>
 #include <smooth/misc/number.h>
-#include <smooth/foreach.h>
+#include <smooth/misc/stringview.h>
 
 #include <unistd.h>
 #include <stdio.h>
@@ -361,41 +361,49 @@ S::Int S::GUI::SurfaceXLib::SetText(const String &string, const Rect &iRect, con
 
 	/* Draw text line by line.
 	 */
-	const Array<String>	&lines = string.Explode("\n");
+	StringTokenizer	 lines(string, "\n");
+	StringView	 view;
 
-	foreach (String line, lines)
+	Buffer<XftChar16>	 text(string.Length() + 1);
+
+	while (lines.Next(view))
 	{
-		Int	 lineLength = line.Length();
+		const wchar_t	*chars	    = view.GetChars();
+		Int		 lineLength = view.Length();
 
 		/* Check for right to left characters in text.
 		 */
 		Bool	 rtlCharacters = False;
 
-		for (Int i = 0; i < lineLength; i++) if (line[i] >= 0x0590 && line[i] <= 0x08FF) { rtlCharacters = True; break; }
+		for (Int i = 0; i < lineLength; i++) if (chars[i] >= 0x0590 && chars[i] <= 0x08FF) { rtlCharacters = True; break; }
 
 		/* Draw text, reordering if necessary.
 		 */
 		Rect	 tRect = rightToLeft.TranslateRect(rect);
 
+		for (Int i = 0; i < lineLength; i++) text[i] = (UnsignedInt32) chars[i] <= 0xFFFF ? chars[i] : '?';
+
 		if (rtlCharacters && Setup::useIconv)
 		{
-			/* Reorder the string with fribidi.
+			/* Reorder the line with fribidi.
 			 */
-			FriBidiChar	*visual = new FriBidiChar [lineLength + 1];
-			FriBidiParType	 type = (rightToLeft.GetRightToLeft() ? FRIBIDI_PAR_RTL : FRIBIDI_PAR_LTR);
+			FriBidiChar	*logical = new FriBidiChar [lineLength + 1];
+			FriBidiChar	*visual	 = new FriBidiChar [lineLength + 1];
+			FriBidiParType	 type	 = (rightToLeft.GetRightToLeft() ? FRIBIDI_PAR_RTL : FRIBIDI_PAR_LTR);
 
-			fribidi_log2vis((FriBidiChar *) line.ConvertTo("UCS-4LE"), lineLength, &type, visual, NIL, NIL, NIL);
+			for (Int i = 0; i < lineLength; i++) logical[i] = chars[i];
 
-			visual[lineLength] = 0;
+			fribidi_log2vis(logical, lineLength, &type, visual, NIL, NIL, NIL);
 
-			line.ImportFrom("UCS-4LE", (char *) visual);
+			for (Int i = 0; i < lineLength; i++) text[i] = visual[i] <= 0xFFFF ? visual[i] : '?';
 
+			delete [] logical;
 			delete [] visual;
 		}
 
-		if (!painting) XftDrawString16(wdraw, &xftcolor, xfont, tRect.left, tRect.top + lineHeight - 4, (XftChar16 *) line.ConvertTo("UCS2"), lineLength);
+		if (!painting) XftDrawString16(wdraw, &xftcolor, xfont, tRect.left, tRect.top + lineHeight - 4, text, lineLength);
 
-		XftDrawString16(bdraw, &xftcolor, xfont, tRect.left, tRect.top + lineHeight - 4, (XftChar16 *) line.ConvertTo("UCS2"), lineLength);
+		XftDrawString16(bdraw, &xftcolor, xfont, tRect.left, tRect.top + lineHeight - 4, text, lineLength);
 
 		rect.top += lineHeight;
 	}
@@ -1,5 +1,5 @@
 /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -70,7 +70,7 @@ S::GUI::Bitmap S::GUI::ImageLoader::Load(const String &fileName)
 {
 	ImageLoader	*loader = NIL;
 
-	if	(fileName.ToLower().Contains(".pci:")) loader = new ImageLoaderPCI(fileName);
+	if	(fileName.ContainsIgnoreCase(".pci:")) loader = new ImageLoaderPCI(fileName);
 #ifdef __WIN32__
 	else if (fileName.StartsWith("Icon:"))	       loader = new ImageLoaderIcon(fileName);
 #endif
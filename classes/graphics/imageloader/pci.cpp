@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2013 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -31,12 +31,9 @@ const S::GUI::Bitmap &S::GUI::ImageLoaderPCI::Load()
 
 	/* Load PCI file.
 	 */
-	String	 pciFile = fileName;
-	String	 idString;
-
-	pciFile[fileName.ToLower().Find(".pci:") + 4] = 0;
-
-	for (Int i = 0; i < fileName.Length() - fileName.ToLower().Find(".pci:") - 5; i++) idString[i] = fileName[fileName.ToLower().Find(".pci:") + 5 + i];
+	Int	 separator = fileName.FindIgnoreCase(".pci:");
+	String	 pciFile   = fileName.Head(separator + 4);
+	String	 idString  = fileName.Tail(fileName.Length() - separator - 5);
 
 	Int	 id = idString.ToInt();
 	PCIIn	 pci = OpenPCIForInput(pciFile);
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2022 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -31,7 +31,7 @@ const Error &S::GUI::Dialogs::FileSelection::ShowDialog()
 	{
 		foreach (const String &filter, filters)
 		{
-			if (!filter.ToLower().Contains(String("*.").Append(defExt).ToLower())) continue;
+			if (!filter.ContainsIgnoreCase(String("*.").Append(defExt))) continue;
 
 			filterIndex = foreachindex + 1;
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2013 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -30,7 +30,7 @@ const S::String &S::I18n::Section::GetString(const String &string) const
 		if (result != NIL) return result;
 	}
 
-	return strings.Get(string.ComputeCRC32());
+	return strings.Get(string);
 }
 
 S::Bool S::I18n::Section::SetContext(const String &nContext)
@@ -51,19 +51,13 @@ S::Bool S::I18n::Section::SetContext(const String &nContext)
 			contextRest = context.Tail(context.Length() - index - 2);
 		}
 
-		foreach (Section *section, sections)
-		{
-			if (section->GetName() == contextFirst)
-			{
-				section->SetContext(contextRest);
+		Section	*section = sections.Get(contextFirst);
 
-				contextSection = section;
+		if (section == NIL) return False;
 
-				return True;
-			}
-		}
+		section->SetContext(contextRest);
 
-		return False;
+		contextSection = section;
 	}
 
 	return True;
@@ -86,7 +80,7 @@ S::Errors::Error S::I18n::Section::Parse(XML::Node *section)
 
 		if (entry->GetName() == entryNode && entry->GetAttributeByName(stringAttribute) != NIL)
 		{
-			strings.Add(entry->GetContent(), entry->GetAttributeByName(stringAttribute)->GetContent().ComputeCRC32());
+			strings.Add(entry->GetAttributeByName(stringAttribute)->GetContent(), entry->GetContent());
 		}
 		else if (entry->GetName() == sectionNode && entry->GetAttributeByName(nameAttribute) != NIL)
 		{
@@ -94,7 +88,7 @@ S::Errors::Error S::I18n::Section::Parse(XML::Node *section)
 
 			section->Parse(entry);
 
-			sections.Add(section, section->GetName().ComputeCRC32());
+			if (!sections.Add(section->GetName(), section)) delete section;
 		}
 	}
 
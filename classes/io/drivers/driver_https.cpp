@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2019 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -9,6 +9,7 @@
   * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
 
 #include <smooth/io/drivers/driver_https.h>
+#include <smooth/misc/stringbuilder.h>
 #include <math.h>
 
 #if defined __WIN32__
@@ -57,11 +58,18 @@ S::IO::DriverHTTPS::DriverHTTPS(const String &proxy, Int httpPort, const String
 
 	/* Send connect request.
 	 */
-	String	 connect = String("CONNECT ").Append(hostName).Append(":").Append(String::FromInt(port)).Append(" HTTP/1.1\n");
+	StringBuilder	 builder(hostName.Length() + 64);
 
-	if (uname != NIL) connect.Append("Proxy-authentication: Basic ").Append(String(String(uname).Append(":").Append(passwd)).EncodeBase64()).Append("\n");
+	builder.Append("CONNECT ").Append(hostName).AppendChar(':').Append(port).Append(" HTTP/1.1\n");
 
-	connect.Append("\n");
+	if (uname != NIL)
+	{
+		StringBuilder	 credentials;
+
+		builder.Append("Proxy-authentication: Basic ").Append(credentials.Append(uname).AppendChar(':').Append(passwd).Finish().EncodeBase64()).AppendChar('\n');
+	}
+
+	String	 connect = builder.AppendChar('\n').Finish();
 
 	if (send(stream, (char *) connect, connect.Length(), 0) < connect.Length()) { Close(); lastError = IO_ERROR_UNEXPECTED; return; }
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2022 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -54,17 +54,18 @@ S::IO::DriverPOSIX::DriverPOSIX(const String &file, Int mode) : Driver()
 #if defined __WIN32__
 	/* Add O_NOINHERIT and O_BINARY options and Unicode prefix on Windows.
 	 */
-	Int	 options  = O_NOINHERIT | O_BINARY;
-	String	 fileName = Directory::MakeExtendedPath(file);
+	Int		 options  = O_NOINHERIT | O_BINARY;
+	String		 fileName = Directory::MakeExtendedPath(file);
+	const wchar_t	*nativeFileName = fileName;
 #else
 	/* Use O_CLOEXEC option on other systems.
 	 */
-	Int	 options  = O_CLOEXEC;
-	String	 fileName = file;
+	Int		 options  = O_CLOEXEC;
+	String		 fileName = file;
 
-	/* Set output format to UTF-8 on non-Windows systems.
+	/* Use UTF-8 file names on non-Windows systems.
 	 */
-	String::OutputFormat	 outputFormat("UTF-8");
+	String::ConvertedString	 nativeFileName(fileName, "UTF-8");
 #endif
 
 	switch (mode)
@@ -74,7 +75,7 @@ S::IO::DriverPOSIX::DriverPOSIX(const String &file, Int mode) : Driver()
 
 			return;
 		case OS_APPEND:		   // open a file for appending data
-			stream = open(fileName, options | O_RDWR | O_CREAT, 0666);
+			stream = open(nativeFileName, options | O_RDWR | O_CREAT, 0666);
 
 			if (stream != -1)
 			{
@@ -85,15 +86,15 @@ S::IO::DriverPOSIX::DriverPOSIX(const String &file, Int mode) : Driver()
 
 			break;
 		case OS_REPLACE:	   // create or overwrite a file
-			stream = open(fileName, options | O_RDWR | O_CREAT | O_TRUNC, 0666);
+			stream = open(nativeFileName, options | O_RDWR | O_CREAT | O_TRUNC, 0666);
 
 			break;
 		case IS_READ | IS_WRITE:   // open a file for reading data
-			stream = open(fileName, options | O_RDWR);
+			stream = open(nativeFileName, options | O_RDWR);
 
 			break;
 		case IS_READ:		   // open a file in read only mode
-			stream = open(fileName, options | O_RDONLY);
+			stream = open(nativeFileName, options | O_RDONLY);
 
 			break;
 	}
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2023 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -18,10 +18,72 @@
 #include <smooth/files/directory.h>
 #include <smooth/files/file.h>
 
+#include <smooth/misc/math.h>
+
 #include <stdio.h>
 #include <stdarg.h>
 #include <memory.h>
 
+namespace smooth
+{
+	namespace IO
+	{
+		typedef Int (*ScanLineKernel)(const UnsignedByte *, Int);
+
+		extern ScanLineKernel	 ScanLine;
+
+		/* Assemble values from bytes in little or big endian order.
+		 * Compilers turn these into single unaligned loads and swaps.
+		 */
+		static inline Void LoadLE(const UnsignedByte *data, UnsignedInt16 &value) { value = data[0] | data[1] << 8; }
+		static inline Void LoadBE(const UnsignedByte *data, UnsignedInt16 &value) { value = data[0] << 8 | data[1]; }
+
+		static inline Void LoadLE(const UnsignedByte *data, UnsignedInt32 &value) { value = UnsignedInt32(data[0]) | UnsignedInt32(data[1]) << 8 | UnsignedInt32(data[2]) << 16 | UnsignedInt32(data[3]) << 24; }
+		static inline Void LoadBE(const UnsignedByte *data, UnsignedInt32 &value) { value = UnsignedInt32(data[0]) << 24 | UnsignedInt32(data[1]) << 16 | UnsignedInt32(data[2]) << 8 | UnsignedInt32(data[3]); }
+
+		static inline Void LoadLE(const UnsignedByte *data, UnsignedInt64 &value) { UnsignedInt32 low, high; LoadLE(data, low); LoadLE(data + 4, high); value = UnsignedInt64(high) << 32 | low; }
+		static inline Void LoadBE(const UnsignedByte *data, UnsignedInt64 &value) { UnsignedInt32 low, high; LoadBE(data + 4, low); LoadBE(data, high); value = UnsignedInt64(high) << 32 | low; }
+
+		/* Count leading or trailing zero bits of non-zero values.
+		 */
+		static inline Int CountLeadingZeros(UnsignedInt64 value)
+		{
+#if defined __GNUC__
+			return __builtin_clzll(value);
+#else
+			Int	 count = 0;
+
+			while (!(value & (UnsignedInt64(1) << 63))) { value <<= 1; count++; }
+
+			return count;
+#endif
+		}
+
+		static inline Int CountTrailingZeros(UnsignedInt64 value)
+		{
+#if defined __GNUC__
+			return __builtin_ctzll(value);
+#else
+			Int	 count = 0;
+
+			while (!(value & 1)) { value >>= 1; count++; }
+
+			return count;
+#endif
+		}
+
+		template <class t, Bool bigEndian> static inline t LoadValue(const UnsignedByte *data)
+		{
+			t	 value;
+
+			if (bigEndian) LoadBE(data, value);
+			else	       LoadLE(data, value);
+
+			return value;
+		}
+	};
+};
+
 S::Int	 S::IO::InStream::defaultPackageSize = 4096;
 
 S::IO::InStream::InStream(Int type, Driver *iDriver)
@@ -266,6 +328,56 @@ S::Int64 S::IO::InStream::InputNumberRaw(Int bytes)	// Raw byte order ABCD
 	return rval;
 }
 
+S::Void S::IO::InStream::RefillBits(Int bits)
+{
+	/* Fill the bit buffer with as many whole bytes as fit.
+	 */
+	Int	 bytes = (63 - bitLength) >> 3;
+
+	if (bytes == 0) return;
+
+	/* Load eight bytes at once if available in the current package.
+	 */
+	if (currentBufferPos >= 0 && currentBufferPos + 8 <= packageSize)
+	{
+		UnsignedInt64	 value;
+
+		if (bitOrder == BITS_MSB_FIRST) { LoadBE(dataBuffer + currentBufferPos, value); bitBuffer |= (value & (~UnsignedInt64(0) << (64 - bytes * 8))) >> bitLength; }
+		else				{ LoadLE(dataBuffer + currentBufferPos, value); bitBuffer |= (value & ((UnsignedInt64(1) << (bytes * 8)) - 1)) << bitLength; }
+
+		bitLength	 += bytes * 8;
+		currentBufferPos += bytes;
+		currentFilePos	 += bytes;
+
+		return;
+	}
+
+	/* Load single bytes near the end of a package. Do not read
+	 * ahead into the next package if we have enough bits.
+	 */
+	for (Int i = 0; i < bytes; i++)
+	{
+		if (currentBufferPos >= packageSize && bitLength >= bits) return;
+
+		if (currentFilePos >= (origfilepos + packageSize)) return;
+
+		while (currentBufferPos >= packageSize)
+		{
+			if (!ReadData()) return;
+		}
+
+		UnsignedInt64	 value = dataBuffer[currentBufferPos];
+
+		if (bitOrder == BITS_MSB_FIRST) bitBuffer |= value << (56 - bitLength);
+		else				bitBuffer |= value << bitLength;
+
+		bitLength += 8;
+
+		currentBufferPos++;
+		currentFilePos++;
+	}
+}
+
 S::Int64 S::IO::InStream::InputBits(Int bits)
 {
 	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return -1; }
@@ -273,40 +385,258 @@ S::Int64 S::IO::InStream::InputBits(Int bits)
 
 	if (!bitstreamActive) InitBitstream();
 
+	/* Split values larger than guaranteed by a refill.
+	 */
+	if (bits > 56)
+	{
+		Int64	 first	= InputBits(bitOrder == BITS_MSB_FIRST ? bits - 32 : 32);
+		Int64	 second	= InputBits(bitOrder == BITS_MSB_FIRST ? 32 : bits - 32);
+
+		if (first == -1 || second == -1) return -1;
+
+		if (bitOrder == BITS_MSB_FIRST) return first << 32 | second;
+		else				return second << 32 | first;
+	}
+
+	if (bitLength < bits) RefillBits(bits);
+	if (bitLength < bits) { lastError = IO_ERROR_NODATA; return -1; }
+
+	if (bits == 0) return 0;
+
 	Int64	 rval = 0;
 
-	while (bitLength < bits)
+	if (bitOrder == BITS_MSB_FIRST) { rval = bitBuffer >> (64 - bits);		       bitBuffer <<= bits; }
+	else				{ rval = bitBuffer & ((UnsignedInt64(1) << bits) - 1); bitBuffer >>= bits; }
+
+	bitLength -= bits;
+
+	return rval;
+}
+
+S::Int64 S::IO::InStream::PeekBits(Int bits)
+{
+	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return -1; }
+	if (bits > 56 || bits < 0)	{ lastError = IO_ERROR_BADPARAM; return -1; }
+
+	if (!bitstreamActive) InitBitstream();
+
+	if (bitLength < bits) RefillBits(bits);
+	if (bitLength < bits) { lastError = IO_ERROR_NODATA; return -1; }
+
+	if (bits == 0) return 0;
+
+	if (bitOrder == BITS_MSB_FIRST) return bitBuffer >> (64 - bits);
+	else				return bitBuffer & ((UnsignedInt64(1) << bits) - 1);
+}
+
+S::Bool S::IO::InStream::SkipBits(Int64 bits)
+{
+	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return False; }
+	if (bits < 0)			{ lastError = IO_ERROR_BADPARAM; return False; }
+
+	while (bits > 0)
 	{
-		if (currentFilePos >= (origfilepos + packageSize)) { lastError = IO_ERROR_UNKNOWN; return -1; }
+		Int	 amount = bits < 56 ? bits : 56;
 
-		while (currentBufferPos >= packageSize)
-		{
-			if (!ReadData()) { lastError = IO_ERROR_NODATA; return -1; }
-		}
+		if (InputBits(amount) == -1) return False;
+
+		bits -= amount;
+	}
+
+	return True;
+}
+
+S::Int64 S::IO::InStream::InputUnary()	// Number of zero bits before a one bit
+{
+	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return -1; }
+
+	if (!bitstreamActive) InitBitstream();
+
+	Int64	 count = 0;
+
+	while (True)
+	{
+		RefillBits(1);
+
+		if (bitLength == 0) { lastError = IO_ERROR_NODATA; return -1; }
 
-		for (Int i = 0; i < 8; i++)
+		/* Consume all buffered bits if they are zero.
+		 */
+		if (bitBuffer == 0)
 		{
-			bitBuffer[bitLength] = IOGetBit(dataBuffer[currentBufferPos], i);
-			bitLength++;
+			count	 += bitLength;
+			bitLength = 0;
+
+			continue;
 		}
 
-		currentBufferPos++;
-		currentFilePos++;
+		/* Find the first one bit and consume it.
+		 */
+		Int	 zeros = 0;
+
+		if (bitOrder == BITS_MSB_FIRST) { zeros = CountLeadingZeros(bitBuffer);  bitBuffer <<= zeros; bitBuffer <<= 1; }
+		else				{ zeros = CountTrailingZeros(bitBuffer); bitBuffer >>= zeros; bitBuffer >>= 1; }
+
+		bitLength -= zeros + 1;
+
+		return count + zeros;
 	}
+}
+
+S::Int64 S::IO::InStream::InputExpGolomb()
+{
+	Int64	 zeros = InputUnary();
 
-	for (Int i = 0; i < bits; i++)
+	if (zeros == -1) return -1;
+	if (zeros  > 62) { lastError = IO_ERROR_UNEXPECTED; return -1; }
+
+	Int64	 rest = InputBits(zeros);
+
+	if (rest == -1) return -1;
+
+	return (Int64(1) << zeros) - 1 + rest;
+}
+
+S::Int64 S::IO::InStream::InputSignedExpGolomb()	// Returns 0 on error
+{
+	Int64	 value = InputExpGolomb();
+
+	if (value == -1) return 0;
+
+	if (value & 1)	return   (value + 1) / 2;
+	else		return -(value / 2);
+}
+
+template <class t, S::Bool bigEndian> t S::IO::InStream::InputValue()
+{
+	if (streamType == STREAM_NONE) { lastError = IO_ERROR_NOTOPEN; return 0; }
+
+	if (bitstreamActive && !keepBits) CompleteBitstream();
+
+	/* Load directly from the package if the value lies inside.
+	 */
+	if (currentBufferPos >= 0 && currentBufferPos + Int(sizeof(t)) <= packageSize)
 	{
-		rval = rval | (Int64(bitBuffer[i]) << i);
+		t	 value = LoadValue<t, bigEndian>(dataBuffer + currentBufferPos);
+
+		currentBufferPos += sizeof(t);
+		currentFilePos	 += sizeof(t);
+
+		return value;
 	}
 
-	bitLength = bitLength - bits;
+	/* Value straddles packages; let InputData collect it.
+	 */
+	UnsignedByte	 data[sizeof(t)];
+
+	if (InputData(data, sizeof(t)) < Int(sizeof(t))) return 0;
+
+	return LoadValue<t, bigEndian>(data);
+}
+
+template <class t, S::Bool bigEndian> S::Int S::IO::InStream::InputValues(Buffer<t> &values, Int count)
+{
+	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; values.Resize(0); return 0; }
+	if (count < 0)			{ lastError = IO_ERROR_BADPARAM; values.Resize(0); return 0; }
+
+	if (bitstreamActive && !keepBits) CompleteBitstream();
+
+	values.Resize(count);
 
-	for (Int i = 0; i < bitLength; i++)
+	Int	 done = 0;
+
+	while (done < count)
 	{
-		bitBuffer[i] = bitBuffer[i + bits];
+		/* Decode all whole values available in the current package.
+		 */
+		Int	 available = currentBufferPos >= 0 ? (packageSize - currentBufferPos) / Int(sizeof(t)) : 0;
+		Int	 amount	   = available < count - done ? available : count - done;
+
+		if (amount > 0)
+		{
+			const UnsignedByte	*data = dataBuffer + currentBufferPos;
+
+			for (Int i = 0; i < amount; i++) values[done + i] = LoadValue<t, bigEndian>(data + i * sizeof(t));
+
+			done		 += amount;
+			currentBufferPos += amount * sizeof(t);
+			currentFilePos	 += amount * sizeof(t);
+
+			continue;
+		}
+
+		/* Read a single value straddling packages.
+		 */
+		UnsignedByte	 data[sizeof(t)];
+
+		if (InputData(data, sizeof(t)) < Int(sizeof(t))) break;
+
+		values[done++] = LoadValue<t, bigEndian>(data);
 	}
 
-	return rval;
+	values.Resize(done);
+
+	return done;
+}
+
+S::UnsignedInt16 S::IO::InStream::ReadU16LE()
+{
+	return InputValue<UnsignedInt16, False>();
+}
+
+S::UnsignedInt16 S::IO::InStream::ReadU16BE()
+{
+	return InputValue<UnsignedInt16, True>();
+}
+
+S::UnsignedInt32 S::IO::InStream::ReadU32LE()
+{
+	return InputValue<UnsignedInt32, False>();
+}
+
+S::UnsignedInt32 S::IO::InStream::ReadU32BE()
+{
+	return InputValue<UnsignedInt32, True>();
+}
+
+S::UnsignedInt64 S::IO::InStream::ReadU64LE()
+{
+	return InputValue<UnsignedInt64, False>();
+}
+
+S::UnsignedInt64 S::IO::InStream::ReadU64BE()
+{
+	return InputValue<UnsignedInt64, True>();
+}
+
+S::Int S::IO::InStream::ReadU16LE(Buffer<UnsignedInt16> &values, Int count)
+{
+	return InputValues<UnsignedInt16, False>(values, count);
+}
+
+S::Int S::IO::InStream::ReadU16BE(Buffer<UnsignedInt16> &values, Int count)
+{
+	return InputValues<UnsignedInt16, True>(values, count);
+}
+
+S::Int S::IO::InStream::ReadU32LE(Buffer<UnsignedInt32> &values, Int count)
+{
+	return InputValues<UnsignedInt32, False>(values, count);
+}
+
+S::Int S::IO::InStream::ReadU32BE(Buffer<UnsignedInt32> &values, Int count)
+{
+	return InputValues<UnsignedInt32, True>(values, count);
+}
+
+S::Int S::IO::InStream::ReadU64LE(Buffer<UnsignedInt64> &values, Int count)
+{
+	return InputValues<UnsignedInt64, False>(values, count);
+}
+
+S::Int S::IO::InStream::ReadU64BE(Buffer<UnsignedInt64> &values, Int count)
+{
+	return InputValues<UnsignedInt64, True>(values, count);
 }
 
 S::String S::IO::InStream::InputString(Int bytes)
@@ -349,48 +679,97 @@ S::String S::IO::InStream::InputString(Int bytes)
 	return String((char *) (UnsignedByte *) stringBuffer);
 }
 
-S::String S::IO::InStream::InputLine()
+S::Int S::IO::InStream::ReadLine()
 {
-	if (streamType == STREAM_NONE)		{ lastError = IO_ERROR_NOTOPEN; return NIL; }
-
 	if (bitstreamActive && !keepBits) CompleteBitstream();
 
-	Long	 inpval;
-	Int	 bytes = 0;
-
-	Buffer<UnsignedByte>	 stringBuffer(1024);
+	Int	 length = 0;
+	Bool	 found	= False;
 
 	while (True)
 	{
-		for (Int i = 0; i < 1024; i++)
+		if (currentFilePos >= (origfilepos + packageSize)) { lineBuffer[length] = 0; return found ? length : -1; }
+
+		while (currentBufferPos >= packageSize)
 		{
-			inpval = InputNumber(1);
+			if (!ReadData()) { lineBuffer[length] = 0; return found ? length : -1; }
+		}
 
-			if (inpval == 0 || inpval == -1)
-			{
-				stringBuffer[bytes] = 0;
+		/* Find the end of the line in the current package.
+		 */
+		const UnsignedByte	*data	   = dataBuffer + currentBufferPos;
+		Int			 available = packageSize - currentBufferPos;
+		Int			 span	   = ScanLine != NIL ? ScanLine(data, available) : 0;
 
-				return String((char *) (UnsignedByte *) stringBuffer);
-			}
+		while (span < available && data[span] != '\n' && data[span] != '\r' && data[span] != 0) span++;
 
-			if (inpval != 13 && inpval != 10)
+		/* Append the span to the line buffer, growing it geometrically.
+		 */
+		if (length + span + 1 > lineBuffer.Size()) lineBuffer.Resize(Math::Max(length + span + 1, lineBuffer.Size() * 2));
+
+		memcpy((char *) lineBuffer + length, data, span);
+
+		length		 += span;
+		currentBufferPos += span;
+		currentFilePos	 += span;
+
+		found = True;
+
+		/* Continue in the next package if the line straddles packages.
+		 */
+		if (span == available) continue;
+
+		UnsignedByte	 terminator = data[span];
+
+		currentBufferPos++;
+		currentFilePos++;
+
+		/* Skip the LF of a CR LF sequence.
+		 */
+		if (terminator == '\r' && currentFilePos < (origfilepos + packageSize))
+		{
+			while (currentBufferPos >= packageSize)
 			{
-				stringBuffer[bytes++] = (char) inpval;
+				if (!ReadData()) break;
 			}
-			else
-			{
-				if (inpval == 13) InputNumber(1);
-
-				stringBuffer[bytes] = 0;
 
-				return String((char *) (UnsignedByte *) stringBuffer);
+			if (currentBufferPos < packageSize && dataBuffer[currentBufferPos] == '\n')
+			{
+				currentBufferPos++;
+				currentFilePos++;
 			}
 		}
 
-		stringBuffer.Resize(bytes + 1024);
+		lineBuffer[length] = 0;
+
+		return length;
 	}
+}
+
+S::String S::IO::InStream::InputLine()
+{
+	if (streamType == STREAM_NONE)		{ lastError = IO_ERROR_NOTOPEN; return NIL; }
+
+	if (lineBuffer.Size() == 0) lineBuffer.Resize(1024);
 
-	return NIL; // never reached
+	if (ReadLine() < 0) lineBuffer[0] = 0;
+
+	return String((char *) lineBuffer);
+}
+
+S::Bool S::IO::InStream::InputLine(String &line)
+{
+	if (streamType == STREAM_NONE)		{ lastError = IO_ERROR_NOTOPEN; return False; }
+
+	if (lineBuffer.Size() == 0) lineBuffer.Resize(1024);
+
+	/* Import into the existing string to reuse its memory.
+	 */
+	if (ReadLine() < 0) { lastError = IO_ERROR_NODATA; line = NIL; return False; }
+
+	line.ImportFrom(String::GetInputFormat(), lineBuffer);
+
+	return True;
 }
 
 S::Int S::IO::InStream::InputData(Void *pointer, Int bytes)
@@ -433,6 +812,7 @@ S::Int S::IO::InStream::InputData(Void *pointer, Int bytes)
 
 S::Bool S::IO::InStream::InitBitstream()
 {
+	bitBuffer	= 0;
 	bitLength	= 0;
 	bitstreamActive	= 1;
 
@@ -441,9 +821,28 @@ S::Bool S::IO::InStream::InitBitstream()
 
 S::Bool S::IO::InStream::CompleteBitstream()
 {
+	Int	 bytes = bitLength / 8;
+
+	bitBuffer	= 0;
 	bitLength	= 0;
 	bitstreamActive	= 0;
 
+	/* Return whole bytes read ahead to the stream.
+	 */
+	if (bytes > 0) Seek(currentFilePos - bytes);
+
+	return True;
+}
+
+S::Bool S::IO::InStream::SetBitOrder(Short newBitOrder)
+{
+	if (streamType == STREAM_NONE)						{ lastError = IO_ERROR_NOTOPEN; return False; }
+	if (newBitOrder != BITS_LSB_FIRST && newBitOrder != BITS_MSB_FIRST)	{ lastError = IO_ERROR_BADPARAM; return False; }
+
+	if (bitstreamActive) CompleteBitstream();
+
+	bitOrder = newBitOrder;
+
 	return True;
 }
 
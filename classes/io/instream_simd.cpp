@@ -0,0 +1,113 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/definitions.h>
+#include <smooth/init.h>
+#include <smooth/system/cpu.h>
+
+#include "../misc/simd.h"
+
+/* Line scanning kernels.
+ *
+ * Kernels check whole vectors for line terminators (CR, LF or NUL)
+ * and return the offset of the first vector containing one or the
+ * number of bytes checked. Callers locate the exact terminator and
+ * check any remaining bytes themselves.
+ */
+namespace smooth
+{
+	namespace IO
+	{
+		typedef Int (*ScanLineKernel)(const UnsignedByte *, Int);
+
+		extern ScanLineKernel	 ScanLine;
+
+		Int			 SelectLineKernels();
+
+#ifdef SMOOTH_SIMD_X86
+		SMOOTH_TARGET("sse2") static Int ScanLineSSE2(const UnsignedByte *data, Int size)
+		{
+			const __m128i	 cr = _mm_set1_epi8('\r');
+			const __m128i	 lf = _mm_set1_epi8('\n');
+			const __m128i	 nul = _mm_setzero_si128();
+
+			Int		 i = 0;
+
+			for (; i + 16 <= size; i += 16)
+			{
+				__m128i	 in = _mm_loadu_si128((const __m128i *) (data + i));
+
+				if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(in, cr), _mm_cmpeq_epi8(in, lf)), _mm_cmpeq_epi8(in, nul)))) break;
+			}
+
+			return i;
+		}
+
+		SMOOTH_TARGET("avx2") static Int ScanLineAVX2(const UnsignedByte *data, Int size)
+		{
+			const __m256i	 cr = _mm256_set1_epi8('\r');
+			const __m256i	 lf = _mm256_set1_epi8('\n');
+			const __m256i	 nul = _mm256_setzero_si256();
+
+			Int		 i = 0;
+
+			for (; i + 32 <= size; i += 32)
+			{
+				__m256i	 in = _mm256_loadu_si256((const __m256i *) (data + i));
+
+				if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(in, cr), _mm256_cmpeq_epi8(in, lf)), _mm256_cmpeq_epi8(in, nul)))) break;
+			}
+
+			return i;
+		}
+#endif
+
+#ifdef SMOOTH_SIMD_NEON
+		static Int ScanLineNEON(const UnsignedByte *data, Int size)
+		{
+			const uint8x16_t	 cr = vdupq_n_u8('\r');
+			const uint8x16_t	 lf = vdupq_n_u8('\n');
+
+			Int			 i = 0;
+
+			for (; i + 16 <= size; i += 16)
+			{
+				uint8x16_t	 in = vld1q_u8(data + i);
+
+				if (vmaxvq_u8(vorrq_u8(vorrq_u8(vceqq_u8(in, cr), vceqq_u8(in, lf)), vceqzq_u8(in)))) break;
+			}
+
+			return i;
+		}
+#endif
+
+		/* Kernels usable before CPU detection ran.
+		 */
+#ifdef SMOOTH_SIMD_NEON
+		ScanLineKernel		 ScanLine = &ScanLineNEON;
+#else
+		ScanLineKernel		 ScanLine = NIL;
+#endif
+	};
+};
+
+S::Int	 addLineInitTmp = S::AddInitFunction(&S::IO::SelectLineKernels);
+
+S::Int S::IO::SelectLineKernels()
+{
+#ifdef SMOOTH_SIMD_X86
+	System::CPU	 cpu;
+
+	if	(cpu.HasAVX2()) ScanLine = &ScanLineAVX2;
+	else if (cpu.HasSSE2()) ScanLine = &ScanLineSSE2;
+#endif
+
+	return Success();
+}
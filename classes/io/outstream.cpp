@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2023 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -22,6 +22,30 @@
 #include <stdarg.h>
 #include <memory.h>
 
+namespace smooth
+{
+	namespace IO
+	{
+		/* Store values' bytes in little or big endian order.
+		 * Compilers turn these into single swaps and unaligned stores.
+		 */
+		static inline Void StoreLE(UnsignedByte *data, UnsignedInt16 value) { data[0] = value; data[1] = value >> 8; }
+		static inline Void StoreBE(UnsignedByte *data, UnsignedInt16 value) { data[0] = value >> 8; data[1] = value; }
+
+		static inline Void StoreLE(UnsignedByte *data, UnsignedInt32 value) { data[0] = value; data[1] = value >> 8; data[2] = value >> 16; data[3] = value >> 24; }
+		static inline Void StoreBE(UnsignedByte *data, UnsignedInt32 value) { data[0] = value >> 24; data[1] = value >> 16; data[2] = value >> 8; data[3] = value; }
+
+		static inline Void StoreLE(UnsignedByte *data, UnsignedInt64 value) { StoreLE(data, UnsignedInt32(value)); StoreLE(data + 4, UnsignedInt32(value >> 32)); }
+		static inline Void StoreBE(UnsignedByte *data, UnsignedInt64 value) { StoreBE(data, UnsignedInt32(value >> 32)); StoreBE(data + 4, UnsignedInt32(value)); }
+
+		template <class t, Bool bigEndian> static inline Void StoreValue(UnsignedByte *data, t value)
+		{
+			if (bigEndian) StoreBE(data, value);
+			else	       StoreLE(data, value);
+		}
+	};
+};
+
 S::Int	 S::IO::OutStream::defaultPackageSize = 131072;
 
 S::IO::OutStream::OutStream(Int type, Driver *iDriver)
@@ -148,10 +172,10 @@ S::Bool S::IO::OutStream::Flush()
 	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return False; }
 	if (packageSize <= 0)		{ lastError = IO_ERROR_UNKNOWN; return False; }
 
-	if (currentBufferPos <= 0) return True;
-
 	if (bitstreamActive) CompleteBitstream();
 
+	if (currentBufferPos <= 0) return True;
+
 	Int	 ps		= packageSize;
 	Int	 oldcpos	= currentBufferPos;
 
@@ -279,31 +303,38 @@ S::Bool S::IO::OutStream::OutputNumberRaw(Int64 number, Int bytes)
 	return True;
 }
 
-S::Bool S::IO::OutStream::OutputBits(Int64 number, Int bits)
+S::Bool S::IO::OutStream::FlushBits()
 {
-	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return False; }
-	if (packageSize <= 0)		{ lastError = IO_ERROR_UNKNOWN; return False; }
-	if (bits > 64 || bits < 0)	{ lastError = IO_ERROR_BADPARAM; return False; }
+	/* Move whole bytes from the bit buffer to the package.
+	 */
+	Int	 bytes = bitLength >> 3;
 
-	if (!bitstreamActive) InitBitstream();
+	if (bytes == 0) return True;
 
-	for (Int j = 0; j < bits; j++)
+	/* Store eight bytes at once if they fit in the current package.
+	 */
+	if (currentBufferPos + 8 <= packageSize)
 	{
-		bitBuffer[bitLength] = IOGetBit(number, j);
-		bitLength++;
-	}
+		if (bitOrder == BITS_MSB_FIRST) { StoreBE(dataBuffer + currentBufferPos, bitBuffer); bitBuffer <<= bytes * 8; }
+		else				{ StoreLE(dataBuffer + currentBufferPos, bitBuffer); bitBuffer >>= bytes * 8; }
 
-	while (bitLength >= 8)
-	{
-		unsigned char	 out = 0;
+		bitLength	 -= bytes * 8;
+		currentBufferPos += bytes;
+		currentFilePos	 += bytes;
 
-		for (Int i = 0; i < 8; i++) out = out | (bitBuffer[i] << i);
+		if (size < currentFilePos) size = currentFilePos;
 
-		bitLength = bitLength - 8;
+		return True;
+	}
 
-		for (Int j = 0; j < bitLength; j++) bitBuffer[j] = bitBuffer[j + 8];
+	/* Store single bytes near the end of a package.
+	 */
+	for (Int i = 0; i < bytes; i++)
+	{
+		if (bitOrder == BITS_MSB_FIRST) { dataBuffer[currentBufferPos] = bitBuffer >> 56; bitBuffer <<= 8; }
+		else				{ dataBuffer[currentBufferPos] = bitBuffer;	  bitBuffer >>= 8; }
 
-		dataBuffer[currentBufferPos] = out;
+		bitLength -= 8;
 
 		if (currentFilePos == size) size++;
 
@@ -319,6 +350,134 @@ S::Bool S::IO::OutStream::OutputBits(Int64 number, Int bits)
 	return True;
 }
 
+S::Bool S::IO::OutStream::OutputBits(Int64 number, Int bits)
+{
+	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return False; }
+	if (packageSize <= 0)		{ lastError = IO_ERROR_UNKNOWN; return False; }
+	if (bits > 64 || bits < 0)	{ lastError = IO_ERROR_BADPARAM; return False; }
+
+	if (!bitstreamActive) InitBitstream();
+
+	if (bits == 0) return True;
+
+	/* Split values larger than the bit buffer can take.
+	 */
+	if (bits > 56)
+	{
+		if (bitOrder == BITS_MSB_FIRST) return OutputBits(number >> 32, bits - 32) && OutputBits(number, 32);
+		else				return OutputBits(number, 32) && OutputBits(number >> 32, bits - 32);
+	}
+
+	/* Add bits to the buffer, which holds less than a byte here.
+	 */
+	UnsignedInt64	 value = number & ((UnsignedInt64(1) << bits) - 1);
+
+	if (bitOrder == BITS_MSB_FIRST) bitBuffer |= value << (64 - bitLength - bits);
+	else				bitBuffer |= value << bitLength;
+
+	bitLength += bits;
+
+	return FlushBits();
+}
+
+S::Bool S::IO::OutStream::OutputUnary(Int64 zeros)	// Zero bits followed by a one bit
+{
+	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return False; }
+	if (zeros < 0)			{ lastError = IO_ERROR_BADPARAM; return False; }
+
+	for (; zeros > 55; zeros -= 56)
+	{
+		if (!OutputBits(0, 56)) return False;
+	}
+
+	if (bitOrder == BITS_MSB_FIRST) return OutputBits(1, zeros + 1);
+	else				return OutputBits(Int64(1) << zeros, zeros + 1);
+}
+
+S::Bool S::IO::OutStream::OutputExpGolomb(Int64 number)
+{
+	if (streamType == STREAM_NONE)			  { lastError = IO_ERROR_NOTOPEN; return False; }
+	if (number < 0 || number >= (Int64(1) << 62) - 1) { lastError = IO_ERROR_BADPARAM; return False; }
+
+	/* Write the length of number + 1 in unary followed
+	 * by its bits below the most significant one.
+	 */
+	UnsignedInt64	 value = number + 1;
+	Int		 zeros = 0;
+
+	while (value >> (zeros + 1)) zeros++;
+
+	return OutputUnary(zeros) && OutputBits(value - (UnsignedInt64(1) << zeros), zeros);
+}
+
+S::Bool S::IO::OutStream::OutputSignedExpGolomb(Int64 number)
+{
+	if (number > 0) return OutputExpGolomb(2 * number - 1);
+	else		return OutputExpGolomb(-2 * number);
+}
+
+template <class t, S::Bool bigEndian> S::Bool S::IO::OutStream::OutputValue(t value)
+{
+	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return False; }
+	if (packageSize <= 0)		{ lastError = IO_ERROR_UNKNOWN; return False; }
+
+	if (bitstreamActive && !keepBits) CompleteBitstream();
+
+	/* Store directly to the package if the value fits.
+	 */
+	if (currentBufferPos + Int(sizeof(t)) <= packageSize)
+	{
+		StoreValue<t, bigEndian>(dataBuffer + currentBufferPos, value);
+
+		currentBufferPos += sizeof(t);
+		currentFilePos	 += sizeof(t);
+
+		if (size < currentFilePos) size = currentFilePos;
+
+		if (!WriteData()) { lastError = IO_ERROR_UNKNOWN; return False; }
+
+		return True;
+	}
+
+	/* Value straddles packages; let OutputData split it.
+	 */
+	UnsignedByte	 data[sizeof(t)];
+
+	StoreValue<t, bigEndian>(data, value);
+
+	return OutputData(data, sizeof(t));
+}
+
+S::Bool S::IO::OutStream::WriteU16LE(UnsignedInt16 value)
+{
+	return OutputValue<UnsignedInt16, False>(value);
+}
+
+S::Bool S::IO::OutStream::WriteU16BE(UnsignedInt16 value)
+{
+	return OutputValue<UnsignedInt16, True>(value);
+}
+
+S::Bool S::IO::OutStream::WriteU32LE(UnsignedInt32 value)
+{
+	return OutputValue<UnsignedInt32, False>(value);
+}
+
+S::Bool S::IO::OutStream::WriteU32BE(UnsignedInt32 value)
+{
+	return OutputValue<UnsignedInt32, True>(value);
+}
+
+S::Bool S::IO::OutStream::WriteU64LE(UnsignedInt64 value)
+{
+	return OutputValue<UnsignedInt64, False>(value);
+}
+
+S::Bool S::IO::OutStream::WriteU64BE(UnsignedInt64 value)
+{
+	return OutputValue<UnsignedInt64, True>(value);
+}
+
 S::Bool S::IO::OutStream::OutputString(const String &string)
 {
 	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return False; }
@@ -400,6 +559,7 @@ S::Bool S::IO::OutStream::OutputData(const Void *pointer, Int bytes)
 
 S::Bool S::IO::OutStream::InitBitstream()
 {
+	bitBuffer	= 0;
 	bitLength	= 0;
 	bitstreamActive	= 1;
 
@@ -408,14 +568,14 @@ S::Bool S::IO::OutStream::InitBitstream()
 
 S::Bool S::IO::OutStream::CompleteBitstream()
 {
+	/* Pad the last byte with zero bits.
+	 */
 	if (bitLength > 0)
 	{
-		Int	out = 0;
+		UnsignedByte	 out = (bitOrder == BITS_MSB_FIRST) ? bitBuffer >> 56 : bitBuffer;
 
-		for (Int i = 0; i < 8; i++)
-		{
-			if (i < bitLength) out = out | (bitBuffer[i] << i);
-		}
+		bitBuffer = 0;
+		bitLength = 0;
 
 		keepBits = True;
 		OutputNumber(out, 1);
@@ -443,6 +603,18 @@ S::Bool S::IO::OutStream::SetPackageSize(Int newPackageSize)
 	return True;
 }
 
+S::Bool S::IO::OutStream::SetBitOrder(Short newBitOrder)
+{
+	if (streamType == STREAM_NONE)						{ lastError = IO_ERROR_NOTOPEN; return False; }
+	if (newBitOrder != BITS_LSB_FIRST && newBitOrder != BITS_MSB_FIRST)	{ lastError = IO_ERROR_BADPARAM; return False; }
+
+	if (bitstreamActive) CompleteBitstream();
+
+	bitOrder = newBitOrder;
+
+	return True;
+}
+
 S::Bool S::IO::OutStream::SetFilter(Filter *newFilter)
 {
 	if (streamType == STREAM_NONE)	{ lastError = IO_ERROR_NOTOPEN; return False; }
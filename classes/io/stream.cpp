@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2019 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -20,6 +20,9 @@ S::IO::Stream::Stream()
 
 	bitstreamActive	 = False;
 	keepBits	 = False;
+	bitOrder	 = BITS_LSB_FIRST;
+
+	bitBuffer	 = 0;
 	bitLength	 = 0;
 
 	closefile	 = True;
@@ -36,8 +39,6 @@ S::IO::Stream::Stream()
 	origfilepos	 = 0;
 
 	lastError	 = IO_ERROR_OK;
-
-	memset(&bitBuffer, 0, sizeof(bitBuffer));
 }
 
 S::IO::Stream::~Stream()
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -10,6 +10,21 @@
 
 #include <smooth/misc/array.h>
 
+namespace smooth
+{
+	/* Minimum number of entries for which a hash
+	 * index is built once an array becomes unsorted.
+	 */
+	static const Int	 hashThreshold = 16;
+
+	static inline Int HashSlot(Int index, Int hashSize)
+	{
+		UnsignedInt	 hash = (UnsignedInt) index * 2654435769U;
+
+		return (hash ^ (hash >> 16)) & (hashSize - 1);
+	}
+};
+
 S::IndexArray::IndexArray()
 {
 	nOfEntries	  = 0;
@@ -19,6 +34,8 @@ S::IndexArray::IndexArray()
 
 	lastAccessedEntry = 0;
 
+	hashSize	  = 0;
+
 	lockingEnabled	  = False;
 	lock		  = NIL;
 }
@@ -54,6 +71,18 @@ S::Bool S::IndexArray::InsertAtPos(Int position, Int index)
 	if ((position >=	      1 && indices[position - 1] > index) ||
 	    (position <  nOfEntries - 1 && indices[position + 1] < index)) sorted = False;
 
+	/* Maintain hash index for unsorted arrays.
+	 */
+	if (hashSize > 0)
+	{
+		if (nOfEntries * 2 > hashSize) HashRebuild();
+		else			       { HashInsert(index, position); HashUpdate(position + 1, nOfEntries); }
+	}
+	else if (!sorted && nOfEntries >= hashThreshold)
+	{
+		HashRebuild();
+	}
+
 	return True;
 }
 
@@ -83,6 +112,11 @@ S::Bool S::IndexArray::MoveNth(Int n, Int m)
 
 	sorted = False;
 
+	/* Maintain hash index for unsorted arrays.
+	 */
+	if	(hashSize > 0)		     HashUpdate(m < n ? m : n, (m < n ? n : m) + 1);
+	else if (nOfEntries >= hashThreshold) HashRebuild();
+
 	return True;
 }
 
@@ -103,10 +137,20 @@ S::Bool S::IndexArray::RemoveNth(Int n)
 
 	if (nOfEntries == 1) return RemoveAll();
 
+	Int	 index = indices[n];
+
 	memmove(indices + n, indices + n + 1, (nOfEntries - n - 1) * sizeof(Int));
 
 	nOfEntries--;
 
+	/* Maintain hash index for unsorted arrays.
+	 */
+	if (hashSize > 0)
+	{
+		HashRemove(index);
+		HashUpdate(n, nOfEntries);
+	}
+
 	return True;
 }
 
@@ -118,6 +162,8 @@ S::Bool S::IndexArray::RemoveAll()
 
 	indices.Free();
 
+	HashFree();
+
 	nOfEntries	  = 0;
 	greatestIndex	  = 0;
 
@@ -128,6 +174,30 @@ S::Bool S::IndexArray::RemoveAll()
 	return True;
 }
 
+S::Void S::IndexArray::Swap(IndexArray &oArray)
+{
+	Int	 oNOfEntries	    = oArray.nOfEntries;
+	Int	 oGreatestIndex	    = oArray.greatestIndex;
+	Bool	 oSorted	    = oArray.sorted;
+	Int	 oLastAccessedEntry = oArray.lastAccessedEntry;
+	Int	 oHashSize	    = oArray.hashSize;
+
+	oArray.nOfEntries	 = nOfEntries;
+	oArray.greatestIndex	 = greatestIndex;
+	oArray.sorted		 = sorted;
+	oArray.lastAccessedEntry = lastAccessedEntry;
+	oArray.hashSize		 = hashSize;
+
+	nOfEntries	  = oNOfEntries;
+	greatestIndex	  = oGreatestIndex;
+	sorted		  = oSorted;
+	lastAccessedEntry = oLastAccessedEntry;
+	hashSize	  = oHashSize;
+
+	indices.Swap(oArray.indices);
+	hashTable.Swap(oArray.hashTable);
+}
+
 S::Int S::IndexArray::GetNthIndex(Int n) const
 {
 	ReadLock	 lock(*this);
@@ -198,6 +268,13 @@ S::Int S::IndexArray::GetEntryNumberByIndex(Int index) const
 		}
 	}
 
+	/* Use hash index for unsorted lists if available.
+	 */
+	else if (hashSize > 0)
+	{
+		entryNumber = HashFind(index);
+	}
+
 	/* Linear search otherwise.
 	 */
 	else
@@ -212,3 +289,80 @@ S::Int S::IndexArray::GetEntryNumberByIndex(Int index) const
 
 	return entryNumber;
 }
+
+S::Void S::IndexArray::HashRebuild()
+{
+	/* Keep load factor at or below one half.
+	 */
+	hashSize = 32;
+
+	while (hashSize < nOfEntries * 2) hashSize <<= 1;
+
+	hashTable.Resize(hashSize * 2);
+
+	for (Int i = 0; i < hashSize; i++) hashTable[i * 2 + 1] = -1;
+
+	for (Int i = 0; i < nOfEntries; i++) HashInsert(indices[i], i);
+}
+
+S::Void S::IndexArray::HashFree()
+{
+	hashTable.Free();
+
+	hashSize = 0;
+}
+
+S::Void S::IndexArray::HashInsert(Int index, Int position)
+{
+	Int	 slot = HashSlot(index, hashSize);
+
+	while (hashTable[slot * 2 + 1] != -1 && hashTable[slot * 2] != index) slot = (slot + 1) & (hashSize - 1);
+
+	hashTable[slot * 2	] = index;
+	hashTable[slot * 2 + 1] = position;
+}
+
+S::Void S::IndexArray::HashRemove(Int index)
+{
+	Int	 slot = HashSlot(index, hashSize);
+
+	while (hashTable[slot * 2 + 1] != -1 && hashTable[slot * 2] != index) slot = (slot + 1) & (hashSize - 1);
+
+	if (hashTable[slot * 2 + 1] == -1) return;
+
+	/* Shift following entries back to close the gap
+	 * instead of leaving a tombstone.
+	 */
+	for (Int next = (slot + 1) & (hashSize - 1); hashTable[next * 2 + 1] != -1; next = (next + 1) & (hashSize - 1))
+	{
+		Int	 home = HashSlot(hashTable[next * 2], hashSize);
+
+		if (slot <= next ? (slot < home && home <= next) : (slot < home || home <= next)) continue;
+
+		hashTable[slot * 2	] = hashTable[next * 2	  ];
+		hashTable[slot * 2 + 1] = hashTable[next * 2 + 1];
+
+		slot = next;
+	}
+
+	hashTable[slot * 2 + 1] = -1;
+}
+
+S::Void S::IndexArray::HashUpdate(Int first, Int end)
+{
+	for (Int i = first; i < end; i++) HashInsert(indices[i], i);
+}
+
+S::Int S::IndexArray::HashFind(Int index) const
+{
+	Int	 slot = HashSlot(index, hashSize);
+
+	while (hashTable[slot * 2 + 1] != -1)
+	{
+		if (hashTable[slot * 2] == index) return hashTable[slot * 2 + 1];
+
+		slot = (slot + 1) & (hashSize - 1);
+	}
+
+	return -1;
+}
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2016 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -11,6 +11,60 @@
 #include <smooth/misc/encoding/base64.h>
 #include <smooth/misc/math.h>
 
+namespace smooth
+{
+	namespace Encoding
+	{
+		typedef Int (*Base64EncodeKernel)(const UnsignedByte *, Int, char *);
+		typedef Int (*Base64DecodeKernel)(const char *, Int, UnsignedByte *);
+
+		extern Base64EncodeKernel	 Base64Encode;
+		extern Base64DecodeKernel	 Base64Decode;
+
+		static const char		*base64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+		/* Values of Base64 characters, 64 for whitespace
+		 * and 255 for other invalid characters.
+		 */
+		static UnsignedByte		 base64Values[256];
+
+		static Int InitBase64Values()
+		{
+			for (Int i = 0; i < 256; i++) base64Values[i] = 255;
+			for (Int i = 0; i <  64; i++) base64Values[(UnsignedByte) base64Chars[i]] = i;
+
+			base64Values[' ']  = 64;
+			base64Values['\t'] = 64;
+			base64Values['\r'] = 64;
+			base64Values['\n'] = 64;
+
+			return 0;
+		}
+
+		static Int			 initBase64ValuesTmp = InitBase64Values();
+
+		static inline Void EncodeGroup(const UnsignedByte *in, char *out)
+		{
+			out[0] = base64Chars[  in[0]	     >> 2];
+			out[1] = base64Chars[((in[0] &  3) << 4) | (in[1] >> 4)];
+			out[2] = base64Chars[((in[1] & 15) << 2) | (in[2] >> 6)];
+			out[3] = base64Chars[  in[2] & 63];
+		}
+
+		/* Encode full groups of three bytes, using
+		 * the vectorized kernel if available.
+		 */
+		static Int EncodeGroups(const UnsignedByte *in, Int size, char *out)
+		{
+			Int	 i = (Base64Encode != NIL) ? Base64Encode(in, size, out) : 0;
+
+			for (; i + 3 <= size; i += 3) EncodeGroup(in + i, out + i / 3 * 4);
+
+			return i;
+		}
+	};
+};
+
 S::Encoding::Base64::Base64(Buffer<UnsignedByte> &iBuffer) : buffer(iBuffer)
 {
 }
@@ -24,65 +78,229 @@ S::String S::Encoding::Base64::Encode(Int bytes) const
 	if (bytes > buffer.Size()) return NIL;
 	if (bytes == -1) bytes = buffer.Size();
 
-	String	 b64;
+	Base64Encoder	 encoder;
+	Buffer<char>	 chars;
+	Buffer<char>	 end;
+
+	Int		 length = encoder.Feed(buffer, bytes, chars);
+	Int		 rest	= encoder.Finish(end);
+
+	chars.Resize(length + rest + 1);
+
+	memcpy(chars + length, end, rest);
+
+	chars[length + rest] = 0;
+
+	return String((char *) chars);
+}
+
+S::Int S::Encoding::Base64::Decode(const String &string)
+{
+	Int		 length = string.Length();
+	const wchar_t	*wString = string;
+
+	/* Narrow string to single byte characters.
+	 */
+	Buffer<char>	 chars(length);
+
+	for (Int i = 0; i < length; i++) chars[i] = (UnsignedInt32) wString[i] < 0x80 ? wString[i] : 0x80;
+
+	Base64Decoder	 decoder;
+	Buffer<UnsignedByte>	 end;
+
+	Int		 bytes = decoder.Feed(chars, length, buffer);
+	Int		 rest  = decoder.Finish(end);
+
+	if (bytes < 0 || rest < 0) bytes = rest = 0;
+
+	buffer.Resize(bytes + rest + 1);
+
+	memcpy(buffer + bytes, end, rest);
+
+	buffer[bytes + rest] = 0;
+
+	return bytes + rest;
+}
+
+S::Encoding::Base64Encoder::Base64Encoder()
+{
+	Reset();
+}
+
+S::Encoding::Base64Encoder::~Base64Encoder()
+{
+}
+
+S::Bool S::Encoding::Base64Encoder::Reset()
+{
+	numPending = 0;
+
+	return True;
+}
+
+S::Int S::Encoding::Base64Encoder::Feed(const UnsignedByte *data, Int size, Buffer<char> &out)
+{
+	if (size < 0 || (size > 0 && data == NIL)) { out.Resize(0); return 0; }
 
-	/* Set last byte to reserve memory and speed up processing.
+	/* Allocate the whole output at once.
 	 */
-	b64[(Int) Math::Ceil(bytes / 3.0) * 4] = 0;
+	out.Resize((numPending + size) / 3 * 4);
+
+	Int	 length = 0;
 
-	for (Int i = 0; i < bytes; i += 3)
+	/* Complete a pending group first.
+	 */
+	if (numPending > 0)
 	{
-		Int	 val[4] = { 64, 64, 64, 64 };
+		while (numPending < 3 && size > 0) { pending[numPending++] = *data++; size--; }
 
-				   val[0] = 						      buffer[i + 0]      >> 2;
-				   val[1] = ((buffer[i + 0] &  3) << 4) | (((bytes > i + 1) ? buffer[i + 1] : 0) >> 4);
-		if (bytes > i + 1) val[2] = ((buffer[i + 1] & 15) << 2) | (((bytes > i + 2) ? buffer[i + 2] : 0) >> 6);
-		if (bytes > i + 2) val[3] =   buffer[i + 2] & 63;
+		if (numPending < 3) return 0;
 
-		for (Int j = 0; j < 4; j++)
-		{
-			if	(val[j] >=  0 && val[j] <= 25)	b64[i / 3 * 4 + j] = 'A' + val[j] - 0;
-			else if (val[j] >= 26 && val[j] <= 51)	b64[i / 3 * 4 + j] = 'a' + val[j] - 26;
-			else if (val[j] >= 52 && val[j] <= 61)	b64[i / 3 * 4 + j] = '0' + val[j] - 52;
-			else if (val[j] == 62)			b64[i / 3 * 4 + j] = '+';
-			else if (val[j] == 63)			b64[i / 3 * 4 + j] = '/';
-			else if (val[j] == 64)			b64[i / 3 * 4 + j] = '=';
-		}
+		EncodeGroup(pending, out);
+
+		length	   = 4;
+		numPending = 0;
 	}
 
-	return b64;
+	Int	 done = EncodeGroups(data, size, out + length);
+
+	length += done / 3 * 4;
+
+	while (done < size) pending[numPending++] = data[done++];
+
+	return length;
 }
 
-S::Int S::Encoding::Base64::Decode(const String &string)
+S::Int S::Encoding::Base64Encoder::Feed(const Buffer<UnsignedByte> &data, Buffer<char> &out)
+{
+	return Feed(data, data.Size(), out);
+}
+
+S::Int S::Encoding::Base64Encoder::Finish(Buffer<char> &out)
+{
+	if (numPending == 0) { out.Resize(0); return 0; }
+
+	out.Resize(4);
+
+	for (Int i = numPending; i < 3; i++) pending[i] = 0;
+
+	EncodeGroup(pending, out);
+
+	for (Int i = numPending + 1; i < 4; i++) out[i] = '=';
+
+	numPending = 0;
+
+	return 4;
+}
+
+S::Encoding::Base64Decoder::Base64Decoder()
+{
+	Reset();
+}
+
+S::Encoding::Base64Decoder::~Base64Decoder()
+{
+}
+
+S::Bool S::Encoding::Base64Decoder::Reset()
 {
-	Int	 bytes	= 0;
-	Int	 length = string.Length();
+	numPending = 0;
 
-	buffer.Resize(length / 4 * 3 + 1);
+	padded	   = False;
+	failed	   = False;
+
+	return True;
+}
 
-	for (Int i = 0; i < length; i += 4)
+S::Int S::Encoding::Base64Decoder::Feed(const char *data, Int size, Buffer<UnsignedByte> &out)
+{
+	if (failed || size < 0 || (size > 0 && data == NIL)) { failed = True; out.Resize(0); return -1; }
+
+	/* Allocate for the maximum output at once.
+	 */
+	out.Resize((numPending + size + 3) / 4 * 3);
+
+	Int	 length = 0;
+
+	for (Int i = 0; i < size; )
 	{
-		Int	 val[4] = { 64, 64, 64, 64 };
+		/* Decode runs of complete groups with the vectorized kernel.
+		 */
+		if (numPending == 0 && !padded && Base64Decode != NIL)
+		{
+			Int	 done = Base64Decode(data + i, size - i, out + length);
+
+			i	  += done;
+			length += done / 4 * 3;
+
+			if (i == size) break;
+		}
+
+		/* Decode the next character.
+		 */
+		UnsignedByte	 character = data[i++];
+		UnsignedByte	 value	   = base64Values[character];
 
-		for (Int j = 0; j < 4; j++)
+		if (value == 64) continue;
+
+		if (character == '=')
 		{
-			wchar_t	 value = string[i + j];
+			/* Padding completes the data of a partial group.
+			 */
+			if (numPending == 1 || (numPending == 0 && !padded)) { failed = True; break; }
+
+			if (numPending >= 2) out[length++] =  (pending[0]	   << 2) | (pending[1] >> 4);
+			if (numPending >= 3) out[length++] = ((pending[1] & 15) << 4) | (pending[2] >> 2);
 
-			if	(value >= 'A' && value <= 'Z')	val[j] = value - 'A' +  0;
-			else if (value >= 'a' && value <= 'z')	val[j] = value - 'a' + 26;
-			else if (value >= '0' && value <= '9')	val[j] = value - '0' + 52;
-			else if (value == '+')			val[j] = 62;
-			else if (value == '/')			val[j] = 63;
+			numPending = 0;
+			padded	   = True;
+
+			continue;
 		}
 
-		if (val[0] == 64) break;
+		if (value == 255 || padded) { failed = True; break; }
+
+		pending[numPending++] = value;
 
-		if (val[1] != 64) buffer[bytes++] = ( val[0]       << 2) | (val[1] >> 4);
-		if (val[2] != 64) buffer[bytes++] = ((val[1] & 15) << 4) | (val[2] >> 2);
-		if (val[3] != 64) buffer[bytes++] = ((val[2] &  3) << 6) | (val[3]);
+		if (numPending < 4) continue;
 
-		buffer[bytes] = 0;
+		out[length++] =  (pending[0]	   << 2) | (pending[1] >> 4);
+		out[length++] = ((pending[1] & 15) << 4) | (pending[2] >> 2);
+		out[length++] = ((pending[2] &  3) << 6) |  pending[3];
+
+		numPending = 0;
 	}
 
-	return bytes;
+	if (failed) { out.Resize(0); return -1; }
+
+	out.Resize(length);
+
+	return length;
+}
+
+S::Int S::Encoding::Base64Decoder::Feed(const Buffer<char> &data, Buffer<UnsignedByte> &out)
+{
+	return Feed(data, data.Size(), out);
+}
+
+S::Int S::Encoding::Base64Decoder::Finish(Buffer<UnsignedByte> &out)
+{
+	Int	 length = 0;
+
+	/* Decode a final group without padding.
+	 */
+	out.Resize(2);
+
+	if	(failed || numPending == 1) length = -1;
+	else if (numPending == 2)	    length = 1;
+	else if (numPending == 3)	    length = 2;
+
+	if (length >= 1) out[0] =  (pending[0] << 2) | (pending[1] >> 4);
+	if (length >= 2) out[1] = ((pending[1] & 15) << 4) | (pending[2] >> 2);
+
+	out.Resize(Math::Max(length, 0));
+
+	Reset();
+
+	return length;
 }
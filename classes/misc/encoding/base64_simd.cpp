@@ -0,0 +1,308 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/definitions.h>
+#include <smooth/init.h>
+#include <smooth/system/cpu.h>
+
+#include "../simd.h"
+
+/* Base64 kernels.
+ *
+ * Encode kernels convert groups of three bytes and return the number
+ * of bytes consumed. Decode kernels convert groups of four characters
+ * up to the first character that is not part of the Base64 alphabet
+ * and return the number of characters consumed. Kernels never read
+ * or write beyond the input size or the resulting output size.
+ */
+namespace smooth
+{
+	namespace Encoding
+	{
+		typedef Int (*Base64EncodeKernel)(const UnsignedByte *, Int, char *);
+		typedef Int (*Base64DecodeKernel)(const char *, Int, UnsignedByte *);
+
+		extern Base64EncodeKernel	 Base64Encode;
+		extern Base64DecodeKernel	 Base64Decode;
+
+		Int				 SelectBase64Kernels();
+
+#ifdef SMOOTH_SIMD_X86
+		/* Split 12 bytes into 16 six bit indices.
+		 */
+		SMOOTH_TARGET("ssse3") static inline __m128i EncodeIndicesSSSE3(__m128i in)
+		{
+			in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+			__m128i	 ac = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+			__m128i	 bd = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+
+			return _mm_or_si128(ac, bd);
+		}
+
+		/* Map indices to characters by adding an offset
+		 * selected from the range of each index.
+		 */
+		SMOOTH_TARGET("ssse3") static inline __m128i EncodeCharsSSSE3(__m128i indices)
+		{
+			__m128i	 range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+
+			range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+
+			return _mm_add_epi8(indices, _mm_shuffle_epi8(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0), range));
+		}
+
+		SMOOTH_TARGET("ssse3") static Int Base64EncodeSSSE3(const UnsignedByte *in, Int size, char *out)
+		{
+			Int	 i = 0;
+
+			for (; i + 16 <= size; i += 12) _mm_storeu_si128((__m128i *) (out + i / 3 * 4), EncodeCharsSSSE3(EncodeIndicesSSSE3(_mm_loadu_si128((const __m128i *) (in + i)))));
+
+			return i;
+		}
+
+		/* Classify characters and translate them to six bit values.
+		 * Returns False if any character is not in the alphabet.
+		 */
+		SMOOTH_TARGET("ssse3") static inline Bool DecodeValuesSSSE3(__m128i &in)
+		{
+			__m128i	 high  = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0F));
+			__m128i	 low   = _mm_and_si128(in, _mm_set1_epi8(0x0F));
+
+			__m128i	 lowClass  = _mm_shuffle_epi8(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A), low);
+			__m128i	 highClass = _mm_shuffle_epi8(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), high);
+
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lowClass, highClass), _mm_setzero_si128())) != 0xFFFF) return False;
+
+			__m128i	 offset = _mm_shuffle_epi8(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0), _mm_add_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('/')), high));
+
+			in = _mm_add_epi8(in, offset);
+
+			return True;
+		}
+
+		/* Pack 16 six bit values into 12 bytes.
+		 */
+		SMOOTH_TARGET("ssse3") static inline __m128i DecodePackSSSE3(__m128i values)
+		{
+			values = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+
+			return _mm_shuffle_epi8(values, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		}
+
+		SMOOTH_TARGET("ssse3") static Int Base64DecodeSSSE3(const char *in, Int size, UnsignedByte *out)
+		{
+			Int	 i = 0;
+
+			/* Stores write 16 bytes for every 12 decoded,
+			 * so leave enough room at the end.
+			 */
+			for (; i + 24 <= size; i += 16)
+			{
+				__m128i	 values = _mm_loadu_si128((const __m128i *) (in + i));
+
+				if (!DecodeValuesSSSE3(values)) break;
+
+				_mm_storeu_si128((__m128i *) (out + i / 4 * 3), DecodePackSSSE3(values));
+			}
+
+			return i;
+		}
+
+		/* AVX2 kernels processing twice the amount of data.
+		 */
+		SMOOTH_TARGET("avx2") static Int Base64EncodeAVX2(const UnsignedByte *in, Int size, char *out)
+		{
+			const __m256i	 shuffle = _mm256_broadcastsi128_si256(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+			const __m256i	 offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0));
+
+			Int		 i = 0;
+
+			for (; i + 28 <= size; i += 24)
+			{
+				__m256i	 data	 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (in + i))), _mm_loadu_si128((const __m128i *) (in + i + 12)), 1);
+
+				data = _mm256_shuffle_epi8(data, shuffle);
+
+				__m256i	 ac	 = _mm256_mulhi_epu16(_mm256_and_si256(data, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+				__m256i	 bd	 = _mm256_mullo_epi16(_mm256_and_si256(data, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+				__m256i	 indices = _mm256_or_si256(ac, bd);
+
+				__m256i	 range	 = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+
+				range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+
+				_mm256_storeu_si256((__m256i *) (out + i / 3 * 4), _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range)));
+			}
+
+			return i + Base64EncodeSSSE3(in + i, size - i, out + i / 3 * 4);
+		}
+
+		SMOOTH_TARGET("avx2") static Int Base64DecodeAVX2(const char *in, Int size, UnsignedByte *out)
+		{
+			const __m256i	 lowTable    = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A));
+			const __m256i	 highTable   = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+			const __m256i	 offsetTable = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0));
+			const __m256i	 pack	     = _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+			Int		 i = 0;
+
+			/* Stores write 32 bytes for every 24 decoded,
+			 * so leave enough room at the end.
+			 */
+			for (; i + 44 <= size; i += 32)
+			{
+				__m256i	 data  = _mm256_loadu_si256((const __m256i *) (in + i));
+				__m256i	 high  = _mm256_and_si256(_mm256_srli_epi32(data, 4), _mm256_set1_epi8(0x0F));
+				__m256i	 low   = _mm256_and_si256(data, _mm256_set1_epi8(0x0F));
+
+				__m256i	 valid = _mm256_and_si256(_mm256_shuffle_epi8(lowTable, low), _mm256_shuffle_epi8(highTable, high));
+
+				if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(valid, _mm256_setzero_si256())) != -1) break;
+
+				data = _mm256_add_epi8(data, _mm256_shuffle_epi8(offsetTable, _mm256_add_epi8(_mm256_cmpeq_epi8(data, _mm256_set1_epi8('/')), high)));
+				data = _mm256_madd_epi16(_mm256_maddubs_epi16(data, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+				data = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(data, pack), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+				_mm256_storeu_si256((__m256i *) (out + i / 4 * 3), data);
+			}
+
+			return i + Base64DecodeSSSE3(in + i, size - i, out + i / 4 * 3);
+		}
+#endif
+
+#ifdef SMOOTH_SIMD_NEON
+		static const UnsignedByte	 base64Chars[64] = {
+			'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+			'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+			'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+			'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+		};
+
+		/* Values of ASCII characters, 255 for invalid characters.
+		 */
+		static const UnsignedByte	 base64Values[128] = {
+			255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+			255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+			255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62, 255, 255, 255,  63,
+			 52,  53,  54,  55,  56,  57,  58,  59,  60,  61, 255, 255, 255, 255, 255, 255,
+			255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+			 15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255, 255,
+			255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+			 41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255, 255
+		};
+
+		static inline uint8x16x4_t LoadTableNEON(const UnsignedByte *table)
+		{
+			uint8x16x4_t	 result;
+
+			for (Int i = 0; i < 4; i++) result.val[i] = vld1q_u8(table + 16 * i);
+
+			return result;
+		}
+
+		/* NEON kernels processing 48 bytes or 64 characters per iteration.
+		 */
+		static Int Base64EncodeNEON(const UnsignedByte *in, Int size, char *out)
+		{
+			const uint8x16x4_t	 table = LoadTableNEON(base64Chars);
+			const uint8x16_t	 mask  = vdupq_n_u8(63);
+
+			Int			 i = 0;
+
+			for (; i + 48 <= size; i += 48)
+			{
+				uint8x16x3_t	 data = vld3q_u8(in + i);
+				uint8x16x4_t	 chars;
+
+				chars.val[0] = vshrq_n_u8(data.val[0], 2);
+				chars.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(data.val[0], 4), vshrq_n_u8(data.val[1], 4)), mask);
+				chars.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(data.val[1], 2), vshrq_n_u8(data.val[2], 6)), mask);
+				chars.val[3] = vandq_u8(data.val[2], mask);
+
+				for (Int j = 0; j < 4; j++) chars.val[j] = vqtbl4q_u8(table, chars.val[j]);
+
+				vst4q_u8((uint8_t *) out + i / 3 * 4, chars);
+			}
+
+			return i;
+		}
+
+		static Int Base64DecodeNEON(const char *in, Int size, UnsignedByte *out)
+		{
+			const uint8x16x4_t	 lowTable  = LoadTableNEON(base64Values);
+			const uint8x16x4_t	 highTable = LoadTableNEON(base64Values + 64);
+
+			Int			 i = 0;
+
+			for (; i + 64 <= size; i += 64)
+			{
+				uint8x16x4_t	 data  = vld4q_u8((const uint8_t *) in + i);
+				uint8x16_t	 error = vdupq_n_u8(0);
+
+				/* Look up characters below 64 in the first table and
+				 * below 128 in the second one. Others are invalid.
+				 */
+				for (Int j = 0; j < 4; j++)
+				{
+					uint8x16_t	 value = vqtbx4q_u8(vqtbl4q_u8(lowTable, data.val[j]), highTable, vsubq_u8(data.val[j], vdupq_n_u8(64)));
+
+					data.val[j] = vorrq_u8(value, vcgeq_u8(data.val[j], vdupq_n_u8(128)));
+					error	    = vorrq_u8(error, data.val[j]);
+				}
+
+				if (vmaxvq_u8(error) > 63) break;
+
+				uint8x16x3_t	 bytes;
+
+				bytes.val[0] = vorrq_u8(vshlq_n_u8(data.val[0], 2), vshrq_n_u8(data.val[1], 4));
+				bytes.val[1] = vorrq_u8(vshlq_n_u8(data.val[1], 4), vshrq_n_u8(data.val[2], 2));
+				bytes.val[2] = vorrq_u8(vshlq_n_u8(data.val[2], 6), data.val[3]);
+
+				vst3q_u8(out + i / 4 * 3, bytes);
+			}
+
+			return i;
+		}
+#endif
+
+		/* Kernels usable before CPU detection ran.
+		 */
+#ifdef SMOOTH_SIMD_NEON
+		Base64EncodeKernel		 Base64Encode = &Base64EncodeNEON;
+		Base64DecodeKernel		 Base64Decode = &Base64DecodeNEON;
+#else
+		Base64EncodeKernel		 Base64Encode = NIL;
+		Base64DecodeKernel		 Base64Decode = NIL;
+#endif
+	};
+};
+
+S::Int	 addBase64InitTmp = S::AddInitFunction(&S::Encoding::SelectBase64Kernels);
+
+S::Int S::Encoding::SelectBase64Kernels()
+{
+#ifdef SMOOTH_SIMD_X86
+	System::CPU	 cpu;
+
+	if (cpu.HasAVX2())
+	{
+		Base64Encode = &Base64EncodeAVX2;
+		Base64Decode = &Base64DecodeAVX2;
+	}
+	else if (cpu.HasSSSE3())
+	{
+		Base64Encode = &Base64EncodeSSSE3;
+		Base64Decode = &Base64DecodeSSSE3;
+	}
+#endif
+
+	return Success();
+}
@@ -0,0 +1,712 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/misc/hash/blake3.h>
+#include <smooth/misc/math.h>
+#include <smooth/io/instream.h>
+#include <smooth/system/cpu.h>
+#include <smooth/threads/thread.h>
+#include <smooth/threads/mutex.h>
+#include <smooth/threads/semaphore.h>
+#include <smooth/init.h>
+
+#include <string.h>
+
+namespace smooth
+{
+	namespace Hash
+	{
+		typedef Int (*BLAKE3ManyKernel)(const UnsignedByte * const *, Int, Int, UnsignedInt64, Bool, UnsignedInt32, UnsignedInt32, UnsignedInt32, UnsignedByte *);
+
+		extern BLAKE3ManyKernel		 BLAKE3Many;
+
+		static const UnsignedInt32	 blake3IV[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+		static const UnsignedByte	 blake3Schedule[7][16] = {
+			{  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+			{  2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8 },
+			{  3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1 },
+			{ 10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6 },
+			{ 12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4 },
+			{  9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7 },
+			{ 11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13 }
+		};
+
+		/* Domain separation flags.
+		 */
+		static const UnsignedInt32	 ChunkStart = 1 << 0;
+		static const UnsignedInt32	 ChunkEnd   = 1 << 1;
+		static const UnsignedInt32	 Parent	    = 1 << 2;
+		static const UnsignedInt32	 Root	    = 1 << 3;
+
+		static const Int		 ChunkSize  = 1024;
+
+		/* Chunks hashed per group before reducing them
+		 * to a single subtree chaining value.
+		 */
+		static const Int		 GroupSize  = 64;
+
+		/* Minimum number of chunks per thread and
+		 * maximum number of threads per subtree.
+		 */
+		static const Int		 ThreadChunks = 256;
+		static const Int		 MaxThreads   = 64;
+
+		/* Size of blocks read by ComputeFile.
+		 */
+		static const Int		 ReadSize     = 8 * 1024 * 1024;
+
+		static inline UnsignedInt32 RotateRight(UnsignedInt32 x, Int n)
+		{
+			return (x >> n) | (x << (32 - n));
+		}
+
+		static inline Void G(UnsignedInt32 *v, Int a, Int b, Int c, Int d, UnsignedInt32 x, UnsignedInt32 y)
+		{
+			v[a] = v[a] + v[b] + x; v[d] = RotateRight(v[d] ^ v[a], 16);
+			v[c] = v[c] + v[d];	v[b] = RotateRight(v[b] ^ v[c], 12);
+			v[a] = v[a] + v[b] + y; v[d] = RotateRight(v[d] ^ v[a],  8);
+			v[c] = v[c] + v[d];	v[b] = RotateRight(v[b] ^ v[c],  7);
+		}
+
+		/* Compress a block, writing the new chaining value to out.
+		 */
+		static Void Compress(const UnsignedInt32 *cv, const UnsignedByte *block, UnsignedInt64 counter, UnsignedInt32 length, UnsignedInt32 flags, UnsignedInt32 *out)
+		{
+			UnsignedInt32	 m[16];
+			UnsignedInt32	 v[16];
+
+			for (Int i = 0; i < 16; i++) m[i] = block[4 * i] | block[4 * i + 1] << 8 | block[4 * i + 2] << 16 | block[4 * i + 3] << 24;
+
+			for (Int i = 0; i < 8; i++) v[i] = cv[i];
+			for (Int i = 0; i < 4; i++) v[i + 8] = blake3IV[i];
+
+			v[12] = counter;
+			v[13] = counter >> 32;
+			v[14] = length;
+			v[15] = flags;
+
+			for (Int r = 0; r < 7; r++)
+			{
+				const UnsignedByte	*s = blake3Schedule[r];
+
+				G(v, 0, 4,  8, 12, m[s[ 0]], m[s[ 1]]);
+				G(v, 1, 5,  9, 13, m[s[ 2]], m[s[ 3]]);
+				G(v, 2, 6, 10, 14, m[s[ 4]], m[s[ 5]]);
+				G(v, 3, 7, 11, 15, m[s[ 6]], m[s[ 7]]);
+
+				G(v, 0, 5, 10, 15, m[s[ 8]], m[s[ 9]]);
+				G(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+				G(v, 2, 7,  8, 13, m[s[12]], m[s[13]]);
+				G(v, 3, 4,  9, 14, m[s[14]], m[s[15]]);
+			}
+
+			for (Int i = 0; i < 8; i++) out[i] = v[i] ^ v[i + 8];
+		}
+
+		static Void StoreCV(const UnsignedInt32 *cv, UnsignedByte *out)
+		{
+			for (Int i = 0; i < 32; i++) out[i] = cv[i / 4] >> 8 * (i % 4) & 0xFF;
+		}
+
+		/* Hash several inputs of the same number of blocks, writing
+		 * one chaining value per input. Uses SIMD lanes if available.
+		 */
+		static Void HashMany(const UnsignedByte * const *inputs, Int count, Int blocks, UnsignedInt64 counter, Bool increment, UnsignedInt32 flags, UnsignedInt32 flagsStart, UnsignedInt32 flagsEnd, UnsignedByte *out)
+		{
+			Int	 done = 0;
+
+			if (BLAKE3Many != NIL) done = BLAKE3Many(inputs, count, blocks, counter, increment, flags, flagsStart, flagsEnd, out);
+
+			for (Int i = done; i < count; i++)
+			{
+				UnsignedInt32	 cv[8];
+
+				memcpy(cv, blake3IV, sizeof(cv));
+
+				for (Int b = 0; b < blocks; b++) Compress(cv, inputs[i] + 64 * b, counter + (increment ? i : 0), 64, flags | (b == 0 ? flagsStart : 0) | (b == blocks - 1 ? flagsEnd : 0), cv);
+
+				StoreCV(cv, out + 32 * i);
+			}
+		}
+
+		/* Reduce consecutive chaining values in place until
+		 * only the requested number of values is left.
+		 */
+		static Void ReduceParents(UnsignedByte *cvs, Int count, Int target)
+		{
+			const UnsignedByte	*inputs[GroupSize / 2];
+
+			while (count > target)
+			{
+				for (Int i = 0; i < count / 2; i += GroupSize / 2)
+				{
+					Int	 parents = Math::Min(count / 2 - i, GroupSize / 2);
+
+					for (Int j = 0; j < parents; j++) inputs[j] = cvs + 64 * (i + j);
+
+					HashMany(inputs, parents, 1, 0, False, Parent, 0, 0, cvs + 32 * i);
+				}
+
+				count /= 2;
+			}
+		}
+
+		/* Hash a complete subtree of a power of two number of chunks
+		 * down to one or two chaining values.
+		 */
+		static Void HashSubtree(const UnsignedByte *data, Int chunks, UnsignedInt64 counter, UnsignedByte *out, Int target)
+		{
+			Int			 group	= Math::Min(chunks, GroupSize);
+			Int			 groups = chunks / group;
+
+			Buffer<UnsignedByte>	 results(groups * 32);
+			UnsignedByte		 cvs[GroupSize * 32];
+			const UnsignedByte	*inputs[GroupSize];
+
+			for (Int g = 0; g < groups; g++)
+			{
+				for (Int i = 0; i < group; i++) inputs[i] = data + ChunkSize * (g * group + i);
+
+				HashMany(inputs, group, ChunkSize / 64, counter + g * group, True, 0, ChunkStart, ChunkEnd, cvs);
+
+				if (groups == 1) { ReduceParents(cvs, group, target); memcpy(out, cvs, 32 * target); return; }
+
+				ReduceParents(cvs, group, 1);
+
+				memcpy(results + 32 * g, cvs, 32);
+			}
+
+			ReduceParents(results, groups, target);
+
+			memcpy(out, results, 32 * target);
+		}
+
+		/* Task run by a pool worker.
+		 */
+		class BLAKE3Task
+		{
+			public:
+				virtual			~BLAKE3Task()	{ }
+
+				virtual Void		 Run() = 0;
+		};
+
+		/* Subtree hashed by a worker thread.
+		 */
+		class BLAKE3Subtree : public BLAKE3Task
+		{
+			public:
+				const UnsignedByte	*data;
+				Int			 chunks;
+				UnsignedInt64		 counter;
+				UnsignedByte		*out;
+
+				Void			 Run()		{ HashSubtree(data, chunks, counter, out, 1); }
+		};
+
+		/* Feeds data read by ComputeFile on a separate thread.
+		 */
+		class BLAKE3Feeder : public BLAKE3Task
+		{
+			public:
+				BLAKE3			*hash;
+
+				const UnsignedByte	*data;
+				Int			 size;
+
+				Void			 Run()		{ hash->Feed(data, size); }
+		};
+
+		/* Persistent worker thread running one task at a time.
+		 *
+		 * Both semaphores are taken on creation, so they can be
+		 * released to start a task and to signal its completion.
+		 */
+		class BLAKE3Worker
+		{
+			private:
+				Threads::Thread		 thread;
+
+				Threads::Semaphore	 start;
+				Threads::Semaphore	 done;
+
+				BLAKE3Task		*task;
+
+				Int			 Loop(Threads::Thread *);
+			public:
+							 BLAKE3Worker();
+
+				Bool			 Launch()	{ return thread.Start() == Success(); }
+
+				Void			 Post(BLAKE3Task *);
+				Void			 Wait()		{ done.Wait(); }
+		};
+
+		/* Workers are created on first use and kept until Free. The
+		 * mutexes guard the subtree workers and the ComputeFile feeder
+		 * against concurrent use. Callers finding them busy hash inline.
+		 */
+		static Threads::Mutex	*workersMutex		 = NIL;
+		static Threads::Mutex	*feederMutex		 = NIL;
+
+		static BLAKE3Worker	*workers[MaxThreads - 1] = { NIL };
+		static BLAKE3Worker	*feeder			 = NIL;
+
+		Int			 InitBLAKE3Workers();
+		Int			 FreeBLAKE3Workers();
+
+		/* Return a running worker, creating it if necessary.
+		 * Returns NIL if no thread could be started.
+		 */
+		static BLAKE3Worker *GetWorker(BLAKE3Worker *&worker)
+		{
+			if (worker != NIL) return worker;
+
+			worker = new BLAKE3Worker();
+
+			if (!worker->Launch()) { delete worker; worker = NIL; }
+
+			return worker;
+		}
+
+		/* Hash a subtree down to two chaining values,
+		 * splitting large subtrees across threads.
+		 */
+		static Void HashSubtreeParallel(const UnsignedByte *data, Int chunks, UnsignedInt64 counter, UnsignedByte *out)
+		{
+			static Int	 numThreads = 0;
+
+			if (numThreads == 0) numThreads = Math::Max(1, Math::Min(System::CPU().GetNumLogicalCPUs(), MaxThreads));
+
+			Int	 threads = 1;
+
+			while (threads * 2 <= numThreads && threads * 2 * ThreadChunks <= chunks) threads *= 2;
+
+			if (threads == 1 || initializing || workersMutex == NIL || !workersMutex->TryLock()) { HashSubtree(data, chunks, counter, out, 2); return; }
+
+			/* Hash one part of the subtree per thread and
+			 * reduce the resulting chaining values.
+			 */
+			BLAKE3Subtree		 parts[MaxThreads];
+			BLAKE3Worker		*used[MaxThreads];
+			UnsignedByte		 results[MaxThreads * 32];
+
+			for (Int i = 0; i < threads; i++)
+			{
+				parts[i].data	 = data + (Int64) ChunkSize * (chunks / threads) * i;
+				parts[i].chunks	 = chunks / threads;
+				parts[i].counter = counter + (chunks / threads) * i;
+				parts[i].out	 = results + 32 * i;
+
+				if (i == 0) continue;
+
+				used[i] = GetWorker(workers[i - 1]);
+
+				if (used[i] != NIL) used[i]->Post(&parts[i]);
+			}
+
+			parts[0].Run();
+
+			/* Hash parts inline that no thread could be started for.
+			 */
+			for (Int i = 1; i < threads; i++)
+			{
+				if (used[i] != NIL) used[i]->Wait();
+				else		    parts[i].Run();
+			}
+
+			workersMutex->Release();
+
+			ReduceParents(results, threads, 2);
+
+			memcpy(out, results, 64);
+		}
+	};
+};
+
+S::Int	 addBLAKE3WorkersInitTmp = S::AddInitFunction(&S::Hash::InitBLAKE3Workers);
+S::Int	 addBLAKE3WorkersFreeTmp = S::AddFreeFunction(&S::Hash::FreeBLAKE3Workers);
+
+S::Int S::Hash::InitBLAKE3Workers()
+{
+	workersMutex = new Threads::Mutex();
+	feederMutex  = new Threads::Mutex();
+
+	return Success();
+}
+
+S::Int S::Hash::FreeBLAKE3Workers()
+{
+	/* Worker threads have already been stopped
+	 * by Free, so just delete the workers.
+	 */
+	for (Int i = 0; i < MaxThreads - 1; i++) { delete workers[i]; workers[i] = NIL; }
+
+	delete feeder;
+
+	feeder = NIL;
+
+	delete workersMutex;
+	delete feederMutex;
+
+	workersMutex = NIL;
+	feederMutex  = NIL;
+
+	return Success();
+}
+
+S::Hash::BLAKE3Worker::BLAKE3Worker() : start(1), done(1)
+{
+	task = NIL;
+
+	start.Wait();
+	done.Wait();
+
+	thread.threadMain.Connect(&BLAKE3Worker::Loop, this);
+}
+
+S::Int S::Hash::BLAKE3Worker::Loop(Threads::Thread *)
+{
+	while (start.Wait())
+	{
+		task->Run();
+
+		done.Release();
+	}
+
+	return Success();
+}
+
+S::Void S::Hash::BLAKE3Worker::Post(BLAKE3Task *iTask)
+{
+	task = iTask;
+
+	start.Release();
+}
+
+S::Hash::BLAKE3::BLAKE3()
+{
+	Reset();
+}
+
+S::Hash::BLAKE3::~BLAKE3()
+{
+}
+
+S::Bool S::Hash::BLAKE3::Reset()
+{
+	memcpy(chunkState, blake3IV, sizeof(chunkState));
+
+	chunkCounter	 = 0;
+
+	blockLength	 = 0;
+	blocksCompressed = 0;
+
+	stackDepth	 = 0;
+
+	return True;
+}
+
+S::Void S::Hash::BLAKE3::ChunkFeed(const UnsignedByte *data, Int size)
+{
+	while (size > 0)
+	{
+		/* Compress the buffered block only when more data
+		 * follows as the last block needs different flags.
+		 */
+		if (blockLength == 64)
+		{
+			Compress(chunkState, block, chunkCounter, 64, blocksCompressed == 0 ? ChunkStart : 0, chunkState);
+
+			blocksCompressed++;
+			blockLength = 0;
+		}
+
+		Int	 count = Math::Min(size, 64 - blockLength);
+
+		memcpy(block + blockLength, data, count);
+
+		blockLength += count;
+		data	    += count;
+		size	    -= count;
+	}
+}
+
+S::Void S::Hash::BLAKE3::ChunkFinish(UnsignedByte *cv) const
+{
+	UnsignedInt32	 state[8];
+	UnsignedByte	 last[64];
+
+	memset(last, 0, sizeof(last));
+	memcpy(last, block, blockLength);
+
+	Compress(chunkState, last, chunkCounter, blockLength, ChunkEnd | (blocksCompressed == 0 ? ChunkStart : 0), state);
+
+	StoreCV(state, cv);
+}
+
+S::Void S::Hash::BLAKE3::MergeStack(UnsignedInt64 chunks)
+{
+	/* The stack holds one subtree per set bit of the chunk count.
+	 */
+	Int	 depth = 0;
+
+	for (UnsignedInt64 n = chunks; n != 0; n &= n - 1) depth++;
+
+	while (stackDepth > depth)
+	{
+		const UnsignedByte	*input = stack + 32 * (stackDepth - 2);
+
+		HashMany(&input, 1, 1, 0, False, Parent, 0, 0, stack + 32 * (stackDepth - 2));
+
+		stackDepth--;
+	}
+}
+
+S::Void S::Hash::BLAKE3::PushStack(const UnsignedByte *cv, UnsignedInt64 counter)
+{
+	/* Merge lazily before pushing so that the last
+	 * subtree can still become the root node.
+	 */
+	MergeStack(counter);
+
+	memcpy(stack + 32 * stackDepth++, cv, 32);
+}
+
+S::Bool S::Hash::BLAKE3::Feed(const UnsignedByte *data, Int size)
+{
+	/* Complete a previously started chunk.
+	 */
+	Int	 index = 64 * blocksCompressed + blockLength;
+
+	if (index > 0)
+	{
+		Int	 count = Math::Min(size, ChunkSize - index);
+
+		ChunkFeed(data, count);
+
+		data += count;
+		size -= count;
+
+		if (size == 0) return True;
+
+		UnsignedByte	 cv[32];
+
+		ChunkFinish(cv);
+		PushStack(cv, chunkCounter);
+
+		memcpy(chunkState, blake3IV, sizeof(chunkState));
+
+		chunkCounter++;
+
+		blockLength	 = 0;
+		blocksCompressed = 0;
+	}
+
+	/* Hash the largest complete subtrees possible, keeping at
+	 * least one byte for the final chunk.
+	 */
+	while (size > ChunkSize)
+	{
+		Int	 length = ChunkSize;
+
+		while (length <= size / 2) length *= 2;
+
+		while (((UnsignedInt64) (length - 1) & chunkCounter * ChunkSize) != 0) length /= 2;
+
+		Int	 chunks = length / ChunkSize;
+
+		if (chunks == 1)
+		{
+			UnsignedByte	 cv[32];
+
+			HashMany(&data, 1, ChunkSize / 64, chunkCounter, True, 0, ChunkStart, ChunkEnd, cv);
+
+			PushStack(cv, chunkCounter);
+		}
+		else
+		{
+			UnsignedByte	 cvs[64];
+
+			HashSubtreeParallel(data, chunks, chunkCounter, cvs);
+
+			PushStack(cvs,	    chunkCounter);
+			PushStack(cvs + 32, chunkCounter + chunks / 2);
+		}
+
+		chunkCounter += chunks;
+
+		data += length;
+		size -= length;
+	}
+
+	if (size > 0)
+	{
+		ChunkFeed(data, size);
+		MergeStack(chunkCounter);
+	}
+
+	return True;
+}
+
+S::Bool S::Hash::BLAKE3::Feed(const Buffer<UnsignedByte> &data)
+{
+	return Feed(data, data.Size());
+}
+
+S::Bool S::Hash::BLAKE3::Finish(UnsignedByte *digest)
+{
+	UnsignedInt32	 cv[8];
+	UnsignedByte	 message[64];
+	UnsignedInt64	 counter = 0;
+	UnsignedInt32	 length	 = 64;
+	UnsignedInt32	 flags	 = Parent;
+	Int		 index	 = stackDepth;
+
+	memset(message, 0, sizeof(message));
+
+	/* Start with the current chunk if it holds any data or is the
+	 * only one. Otherwise the two topmost subtrees form the last node.
+	 */
+	if (stackDepth == 0 || blocksCompressed > 0 || blockLength > 0)
+	{
+		memcpy(cv, chunkState, sizeof(cv));
+		memcpy(message, block, blockLength);
+
+		counter = chunkCounter;
+		length	= blockLength;
+		flags	= ChunkEnd | (blocksCompressed == 0 ? ChunkStart : 0);
+	}
+	else
+	{
+		index -= 2;
+
+		memcpy(cv, blake3IV, sizeof(cv));
+		memcpy(message, stack + 32 * index, 64);
+	}
+
+	/* Merge with the remaining subtrees on the stack.
+	 */
+	while (index > 0)
+	{
+		index--;
+
+		Compress(cv, message, counter, length, flags, cv);
+
+		StoreCV(cv, message + 32);
+
+		memcpy(message, stack + 32 * index, 32);
+		memcpy(cv, blake3IV, sizeof(cv));
+
+		counter = 0;
+		length	= 64;
+		flags	= Parent;
+	}
+
+	Compress(cv, message, 0, length, flags | Root, cv);
+
+	StoreCV(cv, digest);
+
+	return True;
+}
+
+S::String S::Hash::BLAKE3::Finish()
+{
+	static const char	*hex = "0123456789abcdef";
+
+	UnsignedByte	 digest[DigestSize];
+	char		 string[2 * DigestSize + 1];
+
+	Finish(digest);
+
+	for (Int i = 0; i < DigestSize; i++)
+	{
+		string[2 * i	] = hex[digest[i] >> 4];
+		string[2 * i + 1] = hex[digest[i] & 15];
+	}
+
+	string[2 * DigestSize] = 0;
+
+	return string;
+}
+
+S::String S::Hash::BLAKE3::Compute(const UnsignedByte *data, Int size)
+{
+	BLAKE3	 blake3;
+
+	blake3.Feed(data, size);
+
+	return blake3.Finish();
+}
+
+S::String S::Hash::BLAKE3::Compute(const Buffer<UnsignedByte> &data)
+{
+	return Compute(data, data.Size());
+}
+
+S::String S::Hash::BLAKE3::ComputeFile(const File &file)
+{
+	IO::InStream	 in(IO::STREAM_FILE, file, IO::IS_READ);
+
+	if (in.GetLastError() != IO::IO_ERROR_OK) return NIL;
+
+	in.SetPackageSize(ReadSize);
+
+	/* Read the next block while hashing the previous one
+	 * on the feeder thread if it is available.
+	 */
+	BLAKE3			 blake3;
+	BLAKE3Feeder		 task;
+	BLAKE3Worker		*worker	 = NIL;
+	Bool			 pending = False;
+
+	if (!initializing && feederMutex != NIL && feederMutex->TryLock())
+	{
+		worker = GetWorker(feeder);
+
+		if (worker == NIL) feederMutex->Release();
+	}
+
+	Buffer<UnsignedByte>	 buffers[2];
+	Int			 current = 0;
+	Int64			 left	 = in.Size();
+	Bool			 error	 = False;
+
+	task.hash = &blake3;
+
+	while (left > 0)
+	{
+		Int	 bytes = Math::Min(left, (Int64) ReadSize);
+
+		buffers[current].Resize(bytes);
+
+		if (in.InputData(buffers[current], bytes) != bytes) { error = True; break; }
+
+		if (pending) { worker->Wait(); pending = False; }
+
+		task.data = buffers[current];
+		task.size = bytes;
+
+		if (worker != NIL) { worker->Post(&task); pending = True; }
+		else		     task.Run();
+
+		left	-= bytes;
+		current	^= 1;
+	}
+
+	if (pending) worker->Wait();
+
+	if (worker != NIL) feederMutex->Release();
+
+	if (error) return NIL;
+
+	return blake3.Finish();
+}
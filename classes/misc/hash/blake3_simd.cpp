@@ -0,0 +1,290 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/definitions.h>
+#include <smooth/init.h>
+#include <smooth/system/cpu.h>
+
+#include "../simd.h"
+
+/* Kernels hashing several BLAKE3 chunks or parent nodes at once.
+ *
+ * Each SIMD lane processes one input of the given number of 64 byte
+ * blocks, starting with the IV as chaining value. Kernels return the
+ * number of inputs processed, which is a multiple of the lane count.
+ */
+namespace smooth
+{
+	namespace Hash
+	{
+		typedef Int (*BLAKE3ManyKernel)(const UnsignedByte * const *, Int, Int, UnsignedInt64, Bool, UnsignedInt32, UnsignedInt32, UnsignedInt32, UnsignedByte *);
+
+		extern BLAKE3ManyKernel		 BLAKE3Many;
+
+		Int				 SelectBLAKE3Kernels();
+
+#ifdef SMOOTH_SIMD_X86
+		static const UnsignedInt32	 blake3IV[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+		static const UnsignedByte	 blake3Schedule[7][16] = {
+			{  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+			{  2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8 },
+			{  3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1 },
+			{ 10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6 },
+			{ 12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4 },
+			{  9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7 },
+			{ 11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13 }
+		};
+
+		/* SSE2 kernel hashing four inputs at a time.
+		 */
+		SMOOTH_TARGET("sse2") static inline __m128i RotateRightSSE2(__m128i x, Int n)
+		{
+			return _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - n));
+		}
+
+		SMOOTH_TARGET("sse2") static inline Void GSSE2(__m128i *v, Int a, Int b, Int c, Int d, __m128i x, __m128i y)
+		{
+			v[a] = _mm_add_epi32(_mm_add_epi32(v[a], v[b]), x); v[d] = RotateRightSSE2(_mm_xor_si128(v[d], v[a]), 16);
+			v[c] = _mm_add_epi32(v[c], v[d]);		     v[b] = RotateRightSSE2(_mm_xor_si128(v[b], v[c]), 12);
+			v[a] = _mm_add_epi32(_mm_add_epi32(v[a], v[b]), y); v[d] = RotateRightSSE2(_mm_xor_si128(v[d], v[a]),  8);
+			v[c] = _mm_add_epi32(v[c], v[d]);		     v[b] = RotateRightSSE2(_mm_xor_si128(v[b], v[c]),  7);
+		}
+
+		SMOOTH_TARGET("sse2") static inline Void TransposeSSE2(__m128i *r)
+		{
+			__m128i	 ab01 = _mm_unpacklo_epi32(r[0], r[1]);
+			__m128i	 ab23 = _mm_unpackhi_epi32(r[0], r[1]);
+			__m128i	 cd01 = _mm_unpacklo_epi32(r[2], r[3]);
+			__m128i	 cd23 = _mm_unpackhi_epi32(r[2], r[3]);
+
+			r[0] = _mm_unpacklo_epi64(ab01, cd01);
+			r[1] = _mm_unpackhi_epi64(ab01, cd01);
+			r[2] = _mm_unpacklo_epi64(ab23, cd23);
+			r[3] = _mm_unpackhi_epi64(ab23, cd23);
+		}
+
+		SMOOTH_TARGET("sse2") static Int BLAKE3ManySSE2(const UnsignedByte * const *inputs, Int count, Int blocks, UnsignedInt64 counter, Bool increment, UnsignedInt32 flags, UnsignedInt32 flagsStart, UnsignedInt32 flagsEnd, UnsignedByte *out)
+		{
+			Int	 done = 0;
+
+			for (; done + 4 <= count; done += 4)
+			{
+				const UnsignedByte * const	*in = inputs + done;
+
+				UnsignedInt32	 low[4];
+				UnsignedInt32	 high[4];
+
+				for (Int l = 0; l < 4; l++)
+				{
+					UnsignedInt64	 n = counter + (increment ? done + l : 0);
+
+					low[l]	= n;
+					high[l] = n >> 32;
+				}
+
+				__m128i	 h[8];
+				__m128i	 m[16];
+				__m128i	 v[16];
+
+				for (Int i = 0; i < 8; i++) h[i] = _mm_set1_epi32(blake3IV[i]);
+
+				for (Int b = 0; b < blocks; b++)
+				{
+					/* Load and transpose message words.
+					 */
+					for (Int g = 0; g < 4; g++)
+					{
+						for (Int l = 0; l < 4; l++) m[4 * g + l] = _mm_loadu_si128((const __m128i *) (in[l] + 64 * b + 16 * g));
+
+						TransposeSSE2(m + 4 * g);
+					}
+
+					for (Int i = 0; i < 8; i++) v[i] = h[i];
+					for (Int i = 0; i < 4; i++) v[i + 8] = _mm_set1_epi32(blake3IV[i]);
+
+					v[12] = _mm_loadu_si128((const __m128i *) low);
+					v[13] = _mm_loadu_si128((const __m128i *) high);
+					v[14] = _mm_set1_epi32(64);
+					v[15] = _mm_set1_epi32(flags | (b == 0 ? flagsStart : 0) | (b == blocks - 1 ? flagsEnd : 0));
+
+					for (Int r = 0; r < 7; r++)
+					{
+						const UnsignedByte	*s = blake3Schedule[r];
+
+						GSSE2(v, 0, 4,  8, 12, m[s[ 0]], m[s[ 1]]);
+						GSSE2(v, 1, 5,  9, 13, m[s[ 2]], m[s[ 3]]);
+						GSSE2(v, 2, 6, 10, 14, m[s[ 4]], m[s[ 5]]);
+						GSSE2(v, 3, 7, 11, 15, m[s[ 6]], m[s[ 7]]);
+
+						GSSE2(v, 0, 5, 10, 15, m[s[ 8]], m[s[ 9]]);
+						GSSE2(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+						GSSE2(v, 2, 7,  8, 13, m[s[12]], m[s[13]]);
+						GSSE2(v, 3, 4,  9, 14, m[s[14]], m[s[15]]);
+					}
+
+					for (Int i = 0; i < 8; i++) h[i] = _mm_xor_si128(v[i], v[i + 8]);
+				}
+
+				/* Transpose chaining values back and store.
+				 */
+				TransposeSSE2(h);
+				TransposeSSE2(h + 4);
+
+				for (Int l = 0; l < 4; l++)
+				{
+					_mm_storeu_si128((__m128i *) (out + 32 * (done + l)	    ), h[l	  ]);
+					_mm_storeu_si128((__m128i *) (out + 32 * (done + l) + 16), h[l + 4]);
+				}
+			}
+
+			return done;
+		}
+
+		/* AVX2 kernel hashing eight inputs at a time.
+		 */
+		SMOOTH_TARGET("avx2") static inline __m256i RotateRightAVX2(__m256i x, Int n)
+		{
+			if (n == 16) return _mm256_shuffle_epi8(x, _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2, 13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2));
+			if (n ==  8) return _mm256_shuffle_epi8(x, _mm256_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1, 12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1));
+
+			return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+		}
+
+		SMOOTH_TARGET("avx2") static inline Void GAVX2(__m256i *v, Int a, Int b, Int c, Int d, __m256i x, __m256i y)
+		{
+			v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), x); v[d] = RotateRightAVX2(_mm256_xor_si256(v[d], v[a]), 16);
+			v[c] = _mm256_add_epi32(v[c], v[d]);			   v[b] = RotateRightAVX2(_mm256_xor_si256(v[b], v[c]), 12);
+			v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), y); v[d] = RotateRightAVX2(_mm256_xor_si256(v[d], v[a]),  8);
+			v[c] = _mm256_add_epi32(v[c], v[d]);			   v[b] = RotateRightAVX2(_mm256_xor_si256(v[b], v[c]),  7);
+		}
+
+		SMOOTH_TARGET("avx2") static inline Void TransposeAVX2(__m256i *r)
+		{
+			__m256i	 ab0145 = _mm256_unpacklo_epi32(r[0], r[1]);
+			__m256i	 ab2367 = _mm256_unpackhi_epi32(r[0], r[1]);
+			__m256i	 cd0145 = _mm256_unpacklo_epi32(r[2], r[3]);
+			__m256i	 cd2367 = _mm256_unpackhi_epi32(r[2], r[3]);
+			__m256i	 ef0145 = _mm256_unpacklo_epi32(r[4], r[5]);
+			__m256i	 ef2367 = _mm256_unpackhi_epi32(r[4], r[5]);
+			__m256i	 gh0145 = _mm256_unpacklo_epi32(r[6], r[7]);
+			__m256i	 gh2367 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+			__m256i	 abcd04 = _mm256_unpacklo_epi64(ab0145, cd0145);
+			__m256i	 abcd15 = _mm256_unpackhi_epi64(ab0145, cd0145);
+			__m256i	 abcd26 = _mm256_unpacklo_epi64(ab2367, cd2367);
+			__m256i	 abcd37 = _mm256_unpackhi_epi64(ab2367, cd2367);
+			__m256i	 efgh04 = _mm256_unpacklo_epi64(ef0145, gh0145);
+			__m256i	 efgh15 = _mm256_unpackhi_epi64(ef0145, gh0145);
+			__m256i	 efgh26 = _mm256_unpacklo_epi64(ef2367, gh2367);
+			__m256i	 efgh37 = _mm256_unpackhi_epi64(ef2367, gh2367);
+
+			r[0] = _mm256_permute2x128_si256(abcd04, efgh04, 0x20);
+			r[1] = _mm256_permute2x128_si256(abcd15, efgh15, 0x20);
+			r[2] = _mm256_permute2x128_si256(abcd26, efgh26, 0x20);
+			r[3] = _mm256_permute2x128_si256(abcd37, efgh37, 0x20);
+			r[4] = _mm256_permute2x128_si256(abcd04, efgh04, 0x31);
+			r[5] = _mm256_permute2x128_si256(abcd15, efgh15, 0x31);
+			r[6] = _mm256_permute2x128_si256(abcd26, efgh26, 0x31);
+			r[7] = _mm256_permute2x128_si256(abcd37, efgh37, 0x31);
+		}
+
+		SMOOTH_TARGET("avx2") static Int BLAKE3ManyAVX2(const UnsignedByte * const *inputs, Int count, Int blocks, UnsignedInt64 counter, Bool increment, UnsignedInt32 flags, UnsignedInt32 flagsStart, UnsignedInt32 flagsEnd, UnsignedByte *out)
+		{
+			Int	 done = 0;
+
+			for (; done + 8 <= count; done += 8)
+			{
+				const UnsignedByte * const	*in = inputs + done;
+
+				UnsignedInt32	 low[8];
+				UnsignedInt32	 high[8];
+
+				for (Int l = 0; l < 8; l++)
+				{
+					UnsignedInt64	 n = counter + (increment ? done + l : 0);
+
+					low[l]	= n;
+					high[l] = n >> 32;
+				}
+
+				__m256i	 h[8];
+				__m256i	 m[16];
+				__m256i	 v[16];
+
+				for (Int i = 0; i < 8; i++) h[i] = _mm256_set1_epi32(blake3IV[i]);
+
+				for (Int b = 0; b < blocks; b++)
+				{
+					/* Load and transpose message words.
+					 */
+					for (Int g = 0; g < 2; g++)
+					{
+						for (Int l = 0; l < 8; l++) m[8 * g + l] = _mm256_loadu_si256((const __m256i *) (in[l] + 64 * b + 32 * g));
+
+						TransposeAVX2(m + 8 * g);
+					}
+
+					for (Int i = 0; i < 8; i++) v[i] = h[i];
+					for (Int i = 0; i < 4; i++) v[i + 8] = _mm256_set1_epi32(blake3IV[i]);
+
+					v[12] = _mm256_loadu_si256((const __m256i *) low);
+					v[13] = _mm256_loadu_si256((const __m256i *) high);
+					v[14] = _mm256_set1_epi32(64);
+					v[15] = _mm256_set1_epi32(flags | (b == 0 ? flagsStart : 0) | (b == blocks - 1 ? flagsEnd : 0));
+
+					for (Int r = 0; r < 7; r++)
+					{
+						const UnsignedByte	*s = blake3Schedule[r];
+
+						GAVX2(v, 0, 4,  8, 12, m[s[ 0]], m[s[ 1]]);
+						GAVX2(v, 1, 5,  9, 13, m[s[ 2]], m[s[ 3]]);
+						GAVX2(v, 2, 6, 10, 14, m[s[ 4]], m[s[ 5]]);
+						GAVX2(v, 3, 7, 11, 15, m[s[ 6]], m[s[ 7]]);
+
+						GAVX2(v, 0, 5, 10, 15, m[s[ 8]], m[s[ 9]]);
+						GAVX2(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+						GAVX2(v, 2, 7,  8, 13, m[s[12]], m[s[13]]);
+						GAVX2(v, 3, 4,  9, 14, m[s[14]], m[s[15]]);
+					}
+
+					for (Int i = 0; i < 8; i++) h[i] = _mm256_xor_si256(v[i], v[i + 8]);
+				}
+
+				/* Transpose chaining values back and store.
+				 */
+				TransposeAVX2(h);
+
+				for (Int l = 0; l < 8; l++) _mm256_storeu_si256((__m256i *) (out + 32 * (done + l)), h[l]);
+			}
+
+			return done;
+		}
+#endif
+
+		/* Use the portable implementation until CPU detection ran.
+		 */
+		BLAKE3ManyKernel		 BLAKE3Many = NIL;
+	};
+};
+
+S::Int	 addBLAKE3InitTmp = S::AddInitFunction(&S::Hash::SelectBLAKE3Kernels);
+
+S::Int S::Hash::SelectBLAKE3Kernels()
+{
+#ifdef SMOOTH_SIMD_X86
+	System::CPU	 cpu;
+
+	if	(cpu.HasAVX2()) BLAKE3Many = &BLAKE3ManyAVX2;
+	else if (cpu.HasSSE2()) BLAKE3Many = &BLAKE3ManySSE2;
+#endif
+
+	return Success();
+}
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2018 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -10,7 +10,20 @@
 
 #include <smooth/misc/hash/crc32.h>
 
+namespace smooth
+{
+	namespace Hash
+	{
+		typedef Int (*FoldCRCKernel)(const UnsignedByte *, Int, UnsignedInt64, const UnsignedInt64 *, UnsignedByte *);
+
+		extern FoldCRCKernel	 FoldCRC;
+	};
+};
+
 S::UnsignedInt32	 S::Hash::CRC32::table[8][256];
+S::UnsignedInt32	 S::Hash::CRC32::powers[64];
+S::UnsignedInt64	 S::Hash::CRC32::fold[4];
+
 S::Bool			 S::Hash::CRC32::initialized = InitTable();
 
 S::Hash::CRC32::CRC32()
@@ -40,9 +53,54 @@ S::Bool S::Hash::CRC32::InitTable()
 		for (Int j = 1; j < 8; j++) table[j][i] = table[0][table[j - 1][i] & 0xFF] ^ (table[j - 1][i] >> 8);
 	}
 
+	/* Precompute x^(2^n) modulo the polynomial as well as the
+	 * constants for folding by 512 and 128 bits, which are
+	 * x^575, x^511, x^191 and x^127 in the reflected domain.
+	 */
+	powers[0] = 1U << 30;
+
+	for (Int i = 1; i < 64; i++) powers[i] = Multiply(powers[i - 1], powers[i - 1]);
+
+	fold[0] = (UnsignedInt64) XPowN(575) << 32;
+	fold[1] = (UnsignedInt64) XPowN(511) << 32;
+	fold[2] = (UnsignedInt64) XPowN(191) << 32;
+	fold[3] = (UnsignedInt64) XPowN(127) << 32;
+
 	return True;
 }
 
+S::UnsignedInt32 S::Hash::CRC32::Multiply(UnsignedInt32 a, UnsignedInt32 b)
+{
+	/* Multiply two polynomials modulo the CRC polynomial
+	 * with coefficients in reflected bit order.
+	 */
+	UnsignedInt32	 polynomial = 0xEDB88320;
+	UnsignedInt32	 product    = 0;
+
+	for (UnsignedInt32 bit = 1U << 31; bit != 0; bit >>= 1)
+	{
+		if (a & bit) product ^= b;
+
+		b = (b >> 1) ^ (b & 1 ? polynomial : 0);
+	}
+
+	return product;
+}
+
+S::UnsignedInt32 S::Hash::CRC32::XPowN(UnsignedInt64 n)
+{
+	/* Compute x^n modulo the CRC polynomial.
+	 */
+	UnsignedInt32	 value = 1U << 31;
+
+	for (Int i = 0; n != 0; i++, n >>= 1)
+	{
+		if (n & 1) value = Multiply(value, powers[i]);
+	}
+
+	return value;
+}
+
 S::UnsignedInt32 S::Hash::CRC32::Reflect(UnsignedInt32 ref, char ch)
 {
 	UnsignedInt32	 value(0);
@@ -64,7 +122,7 @@ S::Bool S::Hash::CRC32::Reset()
 	return True;
 }
 
-S::Bool S::Hash::CRC32::Feed(const UnsignedByte *data, Int size)
+S::Void S::Hash::CRC32::FeedTables(const UnsignedByte *data, Int size)
 {
 	while (size >= 8)
 	{
@@ -80,6 +138,27 @@ S::Bool S::Hash::CRC32::Feed(const UnsignedByte *data, Int size)
 	}
 
 	while (size--) crc = (crc >> 8) ^ table[0][(crc & 0xFF) ^ *data++];
+}
+
+S::Bool S::Hash::CRC32::Feed(const UnsignedByte *data, Int size)
+{
+	/* Fold large inputs using carry-less multiplication
+	 * if available and reduce the remainder with the tables.
+	 */
+	if (FoldCRC != NIL && size >= 64)
+	{
+		UnsignedByte	 remainder[16];
+		Int		 done = FoldCRC(data, size, crc, fold, remainder);
+
+		crc = 0;
+
+		FeedTables(remainder, 16);
+
+		data += done;
+		size -= done;
+	}
+
+	FeedTables(data, size);
 
 	return True;
 }
@@ -107,3 +186,12 @@ S::UnsignedInt32 S::Hash::CRC32::Compute(const Buffer<UnsignedByte> &data)
 {
 	return Compute(data, data.Size());
 }
+
+S::UnsignedInt32 S::Hash::CRC32::Combine(UnsignedInt32 crc1, UnsignedInt32 crc2, Int64 size2)
+{
+	/* Append size2 zero bytes to the first CRC, then add the second.
+	 */
+	if (size2 <= 0) return crc1;
+
+	return Multiply(crc1, XPowN(8 * (UnsignedInt64) size2)) ^ crc2;
+}
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2018 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -10,7 +10,20 @@
 
 #include <smooth/misc/hash/crc64.h>
 
+namespace smooth
+{
+	namespace Hash
+	{
+		typedef Int (*FoldCRCKernel)(const UnsignedByte *, Int, UnsignedInt64, const UnsignedInt64 *, UnsignedByte *);
+
+		extern FoldCRCKernel	 FoldCRC;
+	};
+};
+
 S::UnsignedInt64	 S::Hash::CRC64::table[8][256];
+S::UnsignedInt64	 S::Hash::CRC64::powers[64];
+S::UnsignedInt64	 S::Hash::CRC64::fold[4];
+
 S::Bool			 S::Hash::CRC64::initialized = InitTable();
 
 S::Hash::CRC64::CRC64()
@@ -40,9 +53,54 @@ S::Bool S::Hash::CRC64::InitTable()
 		for (Int j = 1; j < 8; j++) table[j][i] = table[0][table[j - 1][i] & 0xFF] ^ (table[j - 1][i] >> 8);
 	}
 
+	/* Precompute x^(2^n) modulo the polynomial as well as the
+	 * constants for folding by 512 and 128 bits, which are
+	 * x^575, x^511, x^191 and x^127 in the reflected domain.
+	 */
+	powers[0] = 1ULL << 62;
+
+	for (Int i = 1; i < 64; i++) powers[i] = Multiply(powers[i - 1], powers[i - 1]);
+
+	fold[0] = XPowN(575);
+	fold[1] = XPowN(511);
+	fold[2] = XPowN(191);
+	fold[3] = XPowN(127);
+
 	return True;
 }
 
+S::UnsignedInt64 S::Hash::CRC64::Multiply(UnsignedInt64 a, UnsignedInt64 b)
+{
+	/* Multiply two polynomials modulo the CRC polynomial
+	 * with coefficients in reflected bit order.
+	 */
+	UnsignedInt64	 polynomial = 0x95AC9329AC4BC9B5ULL;
+	UnsignedInt64	 product    = 0;
+
+	for (UnsignedInt64 bit = 1ULL << 63; bit != 0; bit >>= 1)
+	{
+		if (a & bit) product ^= b;
+
+		b = (b >> 1) ^ (b & 1 ? polynomial : 0);
+	}
+
+	return product;
+}
+
+S::UnsignedInt64 S::Hash::CRC64::XPowN(UnsignedInt64 n)
+{
+	/* Compute x^n modulo the CRC polynomial.
+	 */
+	UnsignedInt64	 value = 1ULL << 63;
+
+	for (Int i = 0; n != 0; i++, n >>= 1)
+	{
+		if (n & 1) value = Multiply(value, powers[i]);
+	}
+
+	return value;
+}
+
 S::Bool S::Hash::CRC64::Reset()
 {
 	crc = 0xFFFFFFFFFFFFFFFFULL;
@@ -50,7 +108,7 @@ S::Bool S::Hash::CRC64::Reset()
 	return True;
 }
 
-S::Bool S::Hash::CRC64::Feed(const UnsignedByte *data, Int size)
+S::Void S::Hash::CRC64::FeedTables(const UnsignedByte *data, Int size)
 {
 	while (size >= 8)
 	{
@@ -64,6 +122,27 @@ S::Bool S::Hash::CRC64::Feed(const UnsignedByte *data, Int size)
 	}
 
 	while (size--) crc = (crc >> 8) ^ table[0][(crc & 0xFF) ^ *data++];
+}
+
+S::Bool S::Hash::CRC64::Feed(const UnsignedByte *data, Int size)
+{
+	/* Fold large inputs using carry-less multiplication
+	 * if available and reduce the remainder with the tables.
+	 */
+	if (FoldCRC != NIL && size >= 64)
+	{
+		UnsignedByte	 remainder[16];
+		Int		 done = FoldCRC(data, size, crc, fold, remainder);
+
+		crc = 0;
+
+		FeedTables(remainder, 16);
+
+		data += done;
+		size -= done;
+	}
+
+	FeedTables(data, size);
 
 	return True;
 }
@@ -91,3 +170,12 @@ S::UnsignedInt64 S::Hash::CRC64::Compute(const Buffer<UnsignedByte> &data)
 {
 	return Compute(data, data.Size());
 }
+
+S::UnsignedInt64 S::Hash::CRC64::Combine(UnsignedInt64 crc1, UnsignedInt64 crc2, Int64 size2)
+{
+	/* Append size2 zero bytes to the first CRC, then add the second.
+	 */
+	if (size2 <= 0) return crc1;
+
+	return Multiply(crc1, XPowN(8 * (UnsignedInt64) size2)) ^ crc2;
+}
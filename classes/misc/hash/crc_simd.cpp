@@ -0,0 +1,163 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/definitions.h>
+#include <smooth/init.h>
+#include <smooth/system/cpu.h>
+
+#include "../simd.h"
+
+/* Carry-less multiplication is provided by PCLMULQDQ on x86
+ * and by PMULL from the crypto extensions on AArch64.
+ */
+#if defined SMOOTH_SIMD_X86
+#	define SMOOTH_TARGET_CLMUL SMOOTH_TARGET("sse2,pclmul")
+#elif defined SMOOTH_SIMD_NEON && defined __clang__
+#	define SMOOTH_TARGET_CLMUL SMOOTH_TARGET("aes")
+#elif defined SMOOTH_SIMD_NEON
+#	define SMOOTH_TARGET_CLMUL SMOOTH_TARGET("+crypto")
+#else
+#	define SMOOTH_TARGET_CLMUL
+#endif
+
+/* Kernels folding reflected CRCs using carry-less multiplication.
+ *
+ * FoldCRC XORs the CRC register into the first bytes of data and folds
+ * as many 16 byte blocks as possible into one 16 byte remainder that
+ * is congruent to the data modulo the CRC polynomial. It returns the
+ * number of bytes consumed or 0 if size is less than 64 bytes.
+ *
+ * The constants are the 64 bit reflected representations of x^575,
+ * x^511, x^191 and x^127 modulo the polynomial. As products of reflected
+ * values are shifted by one bit, these fold by 512 and 128 bits. The
+ * same kernels serve CRC32 and CRC64 with the respective constants.
+ */
+namespace smooth
+{
+	namespace Hash
+	{
+		typedef Int (*FoldCRCKernel)(const UnsignedByte *, Int, UnsignedInt64, const UnsignedInt64 *, UnsignedByte *);
+
+		extern FoldCRCKernel	 FoldCRC;
+
+		Int			 SelectCRCKernels();
+
+#ifdef SMOOTH_SIMD_X86
+		SMOOTH_TARGET_CLMUL static inline __m128i FoldPCLMUL(__m128i value, __m128i fold, __m128i data)
+		{
+			return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, fold, 0x00),
+							   _mm_clmulepi64_si128(value, fold, 0x11)), data);
+		}
+
+		SMOOTH_TARGET_CLMUL static Int FoldCRCPCLMUL(const UnsignedByte *data, Int size, UnsignedInt64 crc, const UnsignedInt64 *fold, UnsignedByte *rest)
+		{
+			if (size < 64) return 0;
+
+			const __m128i	 k512 = _mm_set_epi64x(fold[1], fold[0]);
+			const __m128i	 k128 = _mm_set_epi64x(fold[3], fold[2]);
+
+			__m128i		 x0   = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (data	  )), _mm_set_epi64x(0, crc));
+			__m128i		 x1   =		      _mm_loadu_si128((const __m128i *) (data + 16));
+			__m128i		 x2   =		      _mm_loadu_si128((const __m128i *) (data + 32));
+			__m128i		 x3   =		      _mm_loadu_si128((const __m128i *) (data + 48));
+
+			Int		 i    = 64;
+
+			/* Fold four independent blocks per iteration.
+			 */
+			for (; i + 64 <= size; i += 64)
+			{
+				x0 = FoldPCLMUL(x0, k512, _mm_loadu_si128((const __m128i *) (data + i	  )));
+				x1 = FoldPCLMUL(x1, k512, _mm_loadu_si128((const __m128i *) (data + i + 16)));
+				x2 = FoldPCLMUL(x2, k512, _mm_loadu_si128((const __m128i *) (data + i + 32)));
+				x3 = FoldPCLMUL(x3, k512, _mm_loadu_si128((const __m128i *) (data + i + 48)));
+			}
+
+			/* Fold blocks into one and append remaining blocks.
+			 */
+			x0 = FoldPCLMUL(x0, k128, x1);
+			x0 = FoldPCLMUL(x0, k128, x2);
+			x0 = FoldPCLMUL(x0, k128, x3);
+
+			for (; i + 16 <= size; i += 16) x0 = FoldPCLMUL(x0, k128, _mm_loadu_si128((const __m128i *) (data + i)));
+
+			_mm_storeu_si128((__m128i *) rest, x0);
+
+			return i;
+		}
+#endif
+
+#ifdef SMOOTH_SIMD_NEON
+		SMOOTH_TARGET_CLMUL static inline uint64x2_t FoldPMULL(uint64x2_t value, uint64x2_t fold, uint64x2_t data)
+		{
+			uint64x2_t	 low  = vreinterpretq_u64_p128(vmull_p64((poly64_t) vgetq_lane_u64(value, 0), (poly64_t) vgetq_lane_u64(fold, 0)));
+			uint64x2_t	 high = vreinterpretq_u64_p128(vmull_p64((poly64_t) vgetq_lane_u64(value, 1), (poly64_t) vgetq_lane_u64(fold, 1)));
+
+			return veorq_u64(veorq_u64(low, high), data);
+		}
+
+		SMOOTH_TARGET_CLMUL static Int FoldCRCPMULL(const UnsignedByte *data, Int size, UnsignedInt64 crc, const UnsignedInt64 *fold, UnsignedByte *rest)
+		{
+			if (size < 64) return 0;
+
+			const uint64x2_t k512 = vld1q_u64((const uint64_t *) fold);
+			const uint64x2_t k128 = vld1q_u64((const uint64_t *) fold + 2);
+
+			uint64x2_t	 x0   = veorq_u64(vreinterpretq_u64_u8(vld1q_u8(data)), vcombine_u64(vcreate_u64(crc), vcreate_u64(0)));
+			uint64x2_t	 x1   =		  vreinterpretq_u64_u8(vld1q_u8(data + 16));
+			uint64x2_t	 x2   =		  vreinterpretq_u64_u8(vld1q_u8(data + 32));
+			uint64x2_t	 x3   =		  vreinterpretq_u64_u8(vld1q_u8(data + 48));
+
+			Int		 i    = 64;
+
+			/* Fold four independent blocks per iteration.
+			 */
+			for (; i + 64 <= size; i += 64)
+			{
+				x0 = FoldPMULL(x0, k512, vreinterpretq_u64_u8(vld1q_u8(data + i	    )));
+				x1 = FoldPMULL(x1, k512, vreinterpretq_u64_u8(vld1q_u8(data + i + 16)));
+				x2 = FoldPMULL(x2, k512, vreinterpretq_u64_u8(vld1q_u8(data + i + 32)));
+				x3 = FoldPMULL(x3, k512, vreinterpretq_u64_u8(vld1q_u8(data + i + 48)));
+			}
+
+			/* Fold blocks into one and append remaining blocks.
+			 */
+			x0 = FoldPMULL(x0, k128, x1);
+			x0 = FoldPMULL(x0, k128, x2);
+			x0 = FoldPMULL(x0, k128, x3);
+
+			for (; i + 16 <= size; i += 16) x0 = FoldPMULL(x0, k128, vreinterpretq_u64_u8(vld1q_u8(data + i)));
+
+			vst1q_u8(rest, vreinterpretq_u8_u64(x0));
+
+			return i;
+		}
+#endif
+
+		/* Use table driven CRCs until CPU detection ran.
+		 */
+		FoldCRCKernel		 FoldCRC = NIL;
+	};
+};
+
+S::Int	 addCRCInitTmp = S::AddInitFunction(&S::Hash::SelectCRCKernels);
+
+S::Int S::Hash::SelectCRCKernels()
+{
+	System::CPU	 cpu;
+
+#if defined SMOOTH_SIMD_X86
+	if (cpu.HasPCLMUL() && cpu.HasSSE2()) FoldCRC = &FoldCRCPCLMUL;
+#elif defined SMOOTH_SIMD_NEON
+	if (cpu.HasPMULL())		      FoldCRC = &FoldCRCPMULL;
+#endif
+
+	return Success();
+}
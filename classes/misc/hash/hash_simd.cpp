@@ -0,0 +1,575 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/definitions.h>
+#include <smooth/init.h>
+#include <smooth/system/cpu.h>
+
+#include <string.h>
+
+#include "../simd.h"
+
+/* Kernels for MD5 and SHA-1.
+ *
+ * Block kernels process a number of consecutive 64 byte blocks of
+ * a single message. Multiple kernels compute the digests of several
+ * independent messages, hashing one message per SIMD lane.
+ */
+namespace smooth
+{
+	namespace Hash
+	{
+		typedef Void (*HashBlocksKernel)(UnsignedInt32 *, const UnsignedByte *, Int);
+		typedef Bool (*HashMultipleKernel)(const UnsignedByte * const *, const Int *, Int, UnsignedByte *);
+
+		extern HashBlocksKernel		 MD5Blocks;
+		extern HashBlocksKernel		 SHA1Blocks;
+
+		extern HashMultipleKernel	 MD5Multiple;
+		extern HashMultipleKernel	 SHA1Multiple;
+
+		Int				 SelectHashKernels();
+
+		/* Lane kernels process one block per lane with state and message
+		 * words stored word by word, i.e. state[word * lanes + lane].
+		 */
+		typedef Void (*HashLanesKernel)(UnsignedInt32 *, const UnsignedInt32 *);
+
+		static const Int		 MaxLanes = 8;
+
+		static const UnsignedInt32	 md5Init[4]  = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+		static const UnsignedInt32	 sha1Init[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+
+		static const UnsignedInt32	 md5Constants[64] = {
+			0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+			0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+			0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+			0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+			0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+			0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+			0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+			0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+		};
+
+		static const Int		 md5Shifts[4][4] = { { 7, 12, 17, 22 }, { 5, 9, 14, 20 }, { 4, 11, 16, 23 }, { 6, 10, 15, 21 } };
+
+		/* Lane state of the multi-buffer scheduler.
+		 */
+		struct HashLane
+		{
+			Int		 message;
+			Int		 offset;
+
+			Int		 tailBlock;
+			Int		 tailBlocks;
+			UnsignedByte	 tail[128];
+		};
+
+		/* Hash independent messages in parallel lanes. Each lane
+		 * picks up the next message as soon as it is done with the
+		 * previous one, so lanes stay busy with uneven sizes.
+		 */
+		static Bool HashMultiple(const UnsignedByte * const *data, const Int *sizes, Int count, UnsignedByte *digests,
+					 HashLanesKernel kernel, Int lanes, const UnsignedInt32 *init, Int nOfWords, Bool bigEndian)
+		{
+			UnsignedInt32	 state[5 * MaxLanes];
+			UnsignedInt32	 words[16 * MaxLanes];
+
+			HashLane	 lane[MaxLanes];
+			Int		 next	= 0;
+			Int		 active = 0;
+
+			memset(words, 0, sizeof(words));
+
+			for (Int l = 0; l < lanes; l++)
+			{
+				lane[l].message = -1;
+
+				if (next < count) { lane[l].message = next++; active++; }
+
+				lane[l].offset	   = 0;
+				lane[l].tailBlocks = 0;
+
+				for (Int w = 0; w < nOfWords; w++) state[w * lanes + l] = init[w];
+			}
+
+			while (active > 0)
+			{
+				/* Gather the next block of each lane.
+				 */
+				for (Int l = 0; l < lanes; l++)
+				{
+					HashLane		&current = lane[l];
+
+					if (current.message == -1) continue;
+
+					const UnsignedByte	*message = data[current.message];
+					Int			 size	 = sizes[current.message];
+					const UnsignedByte	*block	 = NIL;
+
+					if (current.tailBlocks == 0 && current.offset + 64 <= size)
+					{
+						block		= message + current.offset;
+						current.offset += 64;
+					}
+					else
+					{
+						/* Build padded final blocks.
+						 */
+						if (current.tailBlocks == 0)
+						{
+							Int		 rest = size - current.offset;
+							UnsignedInt64	 bits = (UnsignedInt64) size * 8;
+
+							current.tailBlock  = 0;
+							current.tailBlocks = (rest < 56 ? 1 : 2);
+
+							memset(current.tail, 0, sizeof(current.tail));
+
+							if (rest > 0) memcpy(current.tail, message + current.offset, rest);
+
+							current.tail[rest] = 0x80;
+
+							UnsignedByte	*length = current.tail + 64 * current.tailBlocks - 8;
+
+							for (Int i = 0; i < 8; i++) length[i] = bits >> 8 * (bigEndian ? 7 - i : i) & 0xFF;
+						}
+
+						block = current.tail + 64 * current.tailBlock++;
+					}
+
+					if (bigEndian) for (Int w = 0; w < 16; w++) words[w * lanes + l] = block[4 * w] << 24 | block[4 * w + 1] << 16 | block[4 * w + 2] << 8 | block[4 * w + 3];
+					else	       for (Int w = 0; w < 16; w++) words[w * lanes + l] = block[4 * w + 3] << 24 | block[4 * w + 2] << 16 | block[4 * w + 1] << 8 | block[4 * w];
+				}
+
+				kernel(state, words);
+
+				/* Output digests of finished lanes and refill them.
+				 */
+				for (Int l = 0; l < lanes; l++)
+				{
+					HashLane	&current = lane[l];
+
+					if (current.message == -1 || current.tailBlocks == 0 || current.tailBlock < current.tailBlocks) continue;
+
+					UnsignedByte	*digest = digests + current.message * 4 * nOfWords;
+
+					for (Int i = 0; i < 4 * nOfWords; i++) digest[i] = state[(i / 4) * lanes + l] >> 8 * (bigEndian ? 3 - i % 4 : i % 4) & 0xFF;
+
+					current.message	   = -1;
+					current.offset	   = 0;
+					current.tailBlocks = 0;
+
+					if (next < count) current.message = next++;
+					else		  active--;
+
+					for (Int w = 0; w < nOfWords; w++) state[w * lanes + l] = init[w];
+				}
+			}
+
+			return True;
+		}
+
+#ifdef SMOOTH_SIMD_X86
+		/* MD5 and SHA-1 lane kernels for SSE2 and AVX2.
+		 */
+		SMOOTH_TARGET("sse2") static Void MD5LanesSSE2(UnsignedInt32 *state, const UnsignedInt32 *words)
+		{
+			const __m128i	 ones = _mm_set1_epi32(-1);
+
+			__m128i		 w[16];
+
+			for (Int i = 0; i < 16; i++) w[i] = _mm_loadu_si128((const __m128i *) (words + 4 * i));
+
+			__m128i		 a = _mm_loadu_si128((const __m128i *) (state     ));
+			__m128i		 b = _mm_loadu_si128((const __m128i *) (state +  4));
+			__m128i		 c = _mm_loadu_si128((const __m128i *) (state +  8));
+			__m128i		 d = _mm_loadu_si128((const __m128i *) (state + 12));
+
+			__m128i		 aa = a, bb = b, cc = c, dd = d;
+
+			for (Int i = 0; i < 64; i++)
+			{
+				__m128i	 f;
+				Int	 g;
+
+				if	(i < 16) { f = _mm_xor_si128(d, _mm_and_si128(b, _mm_xor_si128(c, d)));	g = i;		     }
+				else if (i < 32) { f = _mm_xor_si128(c, _mm_and_si128(d, _mm_xor_si128(b, c)));	g = (5 * i + 1) % 16; }
+				else if (i < 48) { f = _mm_xor_si128(_mm_xor_si128(b, c), d);			g = (3 * i + 5) % 16; }
+				else		 { f = _mm_xor_si128(c, _mm_or_si128(b, _mm_xor_si128(d, ones)));	g = (7 * i) % 16;     }
+
+				Int	 s = md5Shifts[i / 16][i % 4];
+				__m128i	 x = _mm_add_epi32(_mm_add_epi32(a, f), _mm_add_epi32(w[g], _mm_set1_epi32(md5Constants[i])));
+
+				a = d;
+				d = c;
+				c = b;
+				b = _mm_add_epi32(b, _mm_or_si128(_mm_sll_epi32(x, _mm_cvtsi32_si128(s)), _mm_srl_epi32(x, _mm_cvtsi32_si128(32 - s))));
+			}
+
+			_mm_storeu_si128((__m128i *) (state     ), _mm_add_epi32(a, aa));
+			_mm_storeu_si128((__m128i *) (state +  4), _mm_add_epi32(b, bb));
+			_mm_storeu_si128((__m128i *) (state +  8), _mm_add_epi32(c, cc));
+			_mm_storeu_si128((__m128i *) (state + 12), _mm_add_epi32(d, dd));
+		}
+
+		SMOOTH_TARGET("avx2") static Void MD5LanesAVX2(UnsignedInt32 *state, const UnsignedInt32 *words)
+		{
+			const __m256i	 ones = _mm256_set1_epi32(-1);
+
+			__m256i		 w[16];
+
+			for (Int i = 0; i < 16; i++) w[i] = _mm256_loadu_si256((const __m256i *) (words + 8 * i));
+
+			__m256i		 a = _mm256_loadu_si256((const __m256i *) (state     ));
+			__m256i		 b = _mm256_loadu_si256((const __m256i *) (state +  8));
+			__m256i		 c = _mm256_loadu_si256((const __m256i *) (state + 16));
+			__m256i		 d = _mm256_loadu_si256((const __m256i *) (state + 24));
+
+			__m256i		 aa = a, bb = b, cc = c, dd = d;
+
+			for (Int i = 0; i < 64; i++)
+			{
+				__m256i	 f;
+				Int	 g;
+
+				if	(i < 16) { f = _mm256_xor_si256(d, _mm256_and_si256(b, _mm256_xor_si256(c, d)));	g = i;		     }
+				else if (i < 32) { f = _mm256_xor_si256(c, _mm256_and_si256(d, _mm256_xor_si256(b, c)));	g = (5 * i + 1) % 16; }
+				else if (i < 48) { f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);				g = (3 * i + 5) % 16; }
+				else		 { f = _mm256_xor_si256(c, _mm256_or_si256(b, _mm256_xor_si256(d, ones)));	g = (7 * i) % 16;     }
+
+				Int	 s = md5Shifts[i / 16][i % 4];
+				__m256i	 x = _mm256_add_epi32(_mm256_add_epi32(a, f), _mm256_add_epi32(w[g], _mm256_set1_epi32(md5Constants[i])));
+
+				a = d;
+				d = c;
+				c = b;
+				b = _mm256_add_epi32(b, _mm256_or_si256(_mm256_sll_epi32(x, _mm_cvtsi32_si128(s)), _mm256_srl_epi32(x, _mm_cvtsi32_si128(32 - s))));
+			}
+
+			_mm256_storeu_si256((__m256i *) (state     ), _mm256_add_epi32(a, aa));
+			_mm256_storeu_si256((__m256i *) (state +  8), _mm256_add_epi32(b, bb));
+			_mm256_storeu_si256((__m256i *) (state + 16), _mm256_add_epi32(c, cc));
+			_mm256_storeu_si256((__m256i *) (state + 24), _mm256_add_epi32(d, dd));
+		}
+
+		SMOOTH_TARGET("sse2") static Void SHA1LanesSSE2(UnsignedInt32 *state, const UnsignedInt32 *words)
+		{
+			__m128i		 w[16];
+
+			for (Int i = 0; i < 16; i++) w[i] = _mm_loadu_si128((const __m128i *) (words + 4 * i));
+
+			__m128i		 a = _mm_loadu_si128((const __m128i *) (state     ));
+			__m128i		 b = _mm_loadu_si128((const __m128i *) (state +  4));
+			__m128i		 c = _mm_loadu_si128((const __m128i *) (state +  8));
+			__m128i		 d = _mm_loadu_si128((const __m128i *) (state + 12));
+			__m128i		 e = _mm_loadu_si128((const __m128i *) (state + 16));
+
+			__m128i		 aa = a, bb = b, cc = c, dd = d, ee = e;
+
+			for (Int i = 0; i < 80; i++)
+			{
+				if (i >= 16)
+				{
+					__m128i	 x = _mm_xor_si128(_mm_xor_si128(w[(i - 3) & 15], w[(i - 8) & 15]), _mm_xor_si128(w[(i - 14) & 15], w[i & 15]));
+
+					w[i & 15] = _mm_or_si128(_mm_slli_epi32(x, 1), _mm_srli_epi32(x, 31));
+				}
+
+				__m128i	 f;
+				__m128i	 k;
+
+				if	(i < 20) { f = _mm_xor_si128(d, _mm_and_si128(b, _mm_xor_si128(c, d)));		 k = _mm_set1_epi32(0x5a827999); }
+				else if (i < 40) { f = _mm_xor_si128(_mm_xor_si128(b, c), d);				 k = _mm_set1_epi32(0x6ed9eba1); }
+				else if (i < 60) { f = _mm_or_si128(_mm_and_si128(b, c), _mm_and_si128(d, _mm_or_si128(b, c))); k = _mm_set1_epi32(0x8f1bbcdc); }
+				else		 { f = _mm_xor_si128(_mm_xor_si128(b, c), d);				 k = _mm_set1_epi32(0xca62c1d6); }
+
+				__m128i	 t = _mm_add_epi32(_mm_add_epi32(_mm_or_si128(_mm_slli_epi32(a, 5), _mm_srli_epi32(a, 27)), f), _mm_add_epi32(_mm_add_epi32(e, k), w[i & 15]));
+
+				e = d;
+				d = c;
+				c = _mm_or_si128(_mm_slli_epi32(b, 30), _mm_srli_epi32(b, 2));
+				b = a;
+				a = t;
+			}
+
+			_mm_storeu_si128((__m128i *) (state     ), _mm_add_epi32(a, aa));
+			_mm_storeu_si128((__m128i *) (state +  4), _mm_add_epi32(b, bb));
+			_mm_storeu_si128((__m128i *) (state +  8), _mm_add_epi32(c, cc));
+			_mm_storeu_si128((__m128i *) (state + 12), _mm_add_epi32(d, dd));
+			_mm_storeu_si128((__m128i *) (state + 16), _mm_add_epi32(e, ee));
+		}
+
+		SMOOTH_TARGET("avx2") static Void SHA1LanesAVX2(UnsignedInt32 *state, const UnsignedInt32 *words)
+		{
+			__m256i		 w[16];
+
+			for (Int i = 0; i < 16; i++) w[i] = _mm256_loadu_si256((const __m256i *) (words + 8 * i));
+
+			__m256i		 a = _mm256_loadu_si256((const __m256i *) (state     ));
+			__m256i		 b = _mm256_loadu_si256((const __m256i *) (state +  8));
+			__m256i		 c = _mm256_loadu_si256((const __m256i *) (state + 16));
+			__m256i		 d = _mm256_loadu_si256((const __m256i *) (state + 24));
+			__m256i		 e = _mm256_loadu_si256((const __m256i *) (state + 32));
+
+			__m256i		 aa = a, bb = b, cc = c, dd = d, ee = e;
+
+			for (Int i = 0; i < 80; i++)
+			{
+				if (i >= 16)
+				{
+					__m256i	 x = _mm256_xor_si256(_mm256_xor_si256(w[(i - 3) & 15], w[(i - 8) & 15]), _mm256_xor_si256(w[(i - 14) & 15], w[i & 15]));
+
+					w[i & 15] = _mm256_or_si256(_mm256_slli_epi32(x, 1), _mm256_srli_epi32(x, 31));
+				}
+
+				__m256i	 f;
+				__m256i	 k;
+
+				if	(i < 20) { f = _mm256_xor_si256(d, _mm256_and_si256(b, _mm256_xor_si256(c, d)));			k = _mm256_set1_epi32(0x5a827999); }
+				else if (i < 40) { f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);					k = _mm256_set1_epi32(0x6ed9eba1); }
+				else if (i < 60) { f = _mm256_or_si256(_mm256_and_si256(b, c), _mm256_and_si256(d, _mm256_or_si256(b, c))); k = _mm256_set1_epi32(0x8f1bbcdc); }
+				else		 { f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);					k = _mm256_set1_epi32(0xca62c1d6); }
+
+				__m256i	 t = _mm256_add_epi32(_mm256_add_epi32(_mm256_or_si256(_mm256_slli_epi32(a, 5), _mm256_srli_epi32(a, 27)), f), _mm256_add_epi32(_mm256_add_epi32(e, k), w[i & 15]));
+
+				e = d;
+				d = c;
+				c = _mm256_or_si256(_mm256_slli_epi32(b, 30), _mm256_srli_epi32(b, 2));
+				b = a;
+				a = t;
+			}
+
+			_mm256_storeu_si256((__m256i *) (state     ), _mm256_add_epi32(a, aa));
+			_mm256_storeu_si256((__m256i *) (state +  8), _mm256_add_epi32(b, bb));
+			_mm256_storeu_si256((__m256i *) (state + 16), _mm256_add_epi32(c, cc));
+			_mm256_storeu_si256((__m256i *) (state + 24), _mm256_add_epi32(d, dd));
+			_mm256_storeu_si256((__m256i *) (state + 32), _mm256_add_epi32(e, ee));
+		}
+
+		static Bool MD5MultipleSSE2(const UnsignedByte * const *data, const Int *sizes, Int count, UnsignedByte *digests)
+		{
+			return HashMultiple(data, sizes, count, digests, &MD5LanesSSE2, 4, md5Init, 4, False);
+		}
+
+		static Bool MD5MultipleAVX2(const UnsignedByte * const *data, const Int *sizes, Int count, UnsignedByte *digests)
+		{
+			return HashMultiple(data, sizes, count, digests, &MD5LanesAVX2, 8, md5Init, 4, False);
+		}
+
+		static Bool SHA1MultipleSSE2(const UnsignedByte * const *data, const Int *sizes, Int count, UnsignedByte *digests)
+		{
+			return HashMultiple(data, sizes, count, digests, &SHA1LanesSSE2, 4, sha1Init, 5, True);
+		}
+
+		static Bool SHA1MultipleAVX2(const UnsignedByte * const *data, const Int *sizes, Int count, UnsignedByte *digests)
+		{
+			return HashMultiple(data, sizes, count, digests, &SHA1LanesAVX2, 8, sha1Init, 5, True);
+		}
+
+		/* SHA-1 block kernel vectorizing the message schedule with SSSE3.
+		 *
+		 * Words 32 to 79 use the equivalent recurrence W[t] = (W[t - 6] ^
+		 * W[t - 16] ^ W[t - 28] ^ W[t - 32]) <<< 2, which has no dependencies
+		 * within groups of four words.
+		 */
+		SMOOTH_TARGET("ssse3") static Void SHA1BlocksSSSE3(UnsignedInt32 *state, const UnsignedByte *data, Int blocks)
+		{
+			const __m128i	 swap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+			__m128i		 schedule[20];
+			UnsignedInt32	*word = (UnsignedInt32 *) schedule;
+
+			for (Int n = 0; n < blocks; n++, data += 64)
+			{
+				for (Int j = 0; j < 4; j++) schedule[j] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (data + 16 * j)), swap);
+
+				for (Int t = 16; t < 32; t++)
+				{
+					UnsignedInt32	 x = word[t - 3] ^ word[t - 8] ^ word[t - 14] ^ word[t - 16];
+
+					word[t] = (x << 1) | (x >> 31);
+				}
+
+				for (Int j = 8; j < 20; j++)
+				{
+					__m128i	 x = _mm_xor_si128(_mm_xor_si128(_mm_alignr_epi8(schedule[j - 1], schedule[j - 2], 8), schedule[j - 4]), _mm_xor_si128(schedule[j - 7], schedule[j - 8]));
+
+					schedule[j] = _mm_or_si128(_mm_slli_epi32(x, 2), _mm_srli_epi32(x, 30));
+				}
+
+				UnsignedInt32	 a = state[0];
+				UnsignedInt32	 b = state[1];
+				UnsignedInt32	 c = state[2];
+				UnsignedInt32	 d = state[3];
+				UnsignedInt32	 e = state[4];
+
+#define SHA1_ROUND(f, k)									\
+				{								\
+					UnsignedInt32	 temp = ((a << 5) | (a >> 27)) + (f) + e + k + word[t];	\
+												\
+					e = d;							\
+					d = c;							\
+					c = (b << 30) | (b >> 2);				\
+					b = a;							\
+					a = temp;						\
+				}
+
+				Int	 t = 0;
+
+				for (; t < 20; t++) SHA1_ROUND(d ^ (b & (c ^ d)),	    0x5a827999)
+				for (; t < 40; t++) SHA1_ROUND(b ^ c ^ d,		    0x6ed9eba1)
+				for (; t < 60; t++) SHA1_ROUND((b & c) | (d & (b | c)), 0x8f1bbcdc)
+				for (; t < 80; t++) SHA1_ROUND(b ^ c ^ d,		    0xca62c1d6)
+
+#undef SHA1_ROUND
+
+				state[0] += a;
+				state[1] += b;
+				state[2] += c;
+				state[3] += d;
+				state[4] += e;
+			}
+		}
+
+		/* SHA-1 block kernel using the SHA extensions.
+		 */
+#define SHA1NI_ROUNDS(f, e0, e1, m0, m1, m2, m3)			\
+		e0   = _mm_sha1nexte_epu32(e0, m0);			\
+		e1   = abcd;						\
+		m1   = _mm_sha1msg2_epu32(m1, m0);			\
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, f);		\
+		m3   = _mm_sha1msg1_epu32(m3, m0);			\
+		m2   = _mm_xor_si128(m2, m0);
+
+		SMOOTH_TARGET("sse4.1,sha") static Void SHA1BlocksSHA(UnsignedInt32 *state, const UnsignedByte *data, Int blocks)
+		{
+			const __m128i	 swap = _mm_set_epi64x(0x0001020304050607LL, 0x08090a0b0c0d0e0fLL);
+
+			__m128i		 abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) state), 0x1B);
+			__m128i		 e0   = _mm_set_epi32(state[4], 0, 0, 0);
+			__m128i		 e1;
+
+			for (Int n = 0; n < blocks; n++, data += 64)
+			{
+				__m128i	 abcdSave = abcd;
+				__m128i	 eSave	  = e0;
+
+				__m128i	 m0	  = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (data	 )), swap);
+				__m128i	 m1	  = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (data + 16)), swap);
+				__m128i	 m2	  = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (data + 32)), swap);
+				__m128i	 m3	  = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (data + 48)), swap);
+
+				/* Rounds 0 to 15.
+				 */
+				e0   = _mm_add_epi32(e0, m0);
+				e1   = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+				e1   = _mm_sha1nexte_epu32(e1, m1);
+				e0   = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+				m0   = _mm_sha1msg1_epu32(m0, m1);
+
+				e0   = _mm_sha1nexte_epu32(e0, m2);
+				e1   = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+				m1   = _mm_sha1msg1_epu32(m1, m2);
+				m0   = _mm_xor_si128(m0, m2);
+
+				e1   = _mm_sha1nexte_epu32(e1, m3);
+				e0   = abcd;
+				m0   = _mm_sha1msg2_epu32(m0, m3);
+				abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+				m2   = _mm_sha1msg1_epu32(m2, m3);
+				m1   = _mm_xor_si128(m1, m3);
+
+				/* Rounds 16 to 67.
+				 */
+				SHA1NI_ROUNDS(0, e0, e1, m0, m1, m2, m3)
+				SHA1NI_ROUNDS(1, e1, e0, m1, m2, m3, m0)
+				SHA1NI_ROUNDS(1, e0, e1, m2, m3, m0, m1)
+				SHA1NI_ROUNDS(1, e1, e0, m3, m0, m1, m2)
+				SHA1NI_ROUNDS(1, e0, e1, m0, m1, m2, m3)
+				SHA1NI_ROUNDS(1, e1, e0, m1, m2, m3, m0)
+				SHA1NI_ROUNDS(2, e0, e1, m2, m3, m0, m1)
+				SHA1NI_ROUNDS(2, e1, e0, m3, m0, m1, m2)
+				SHA1NI_ROUNDS(2, e0, e1, m0, m1, m2, m3)
+				SHA1NI_ROUNDS(2, e1, e0, m1, m2, m3, m0)
+				SHA1NI_ROUNDS(2, e0, e1, m2, m3, m0, m1)
+				SHA1NI_ROUNDS(3, e1, e0, m3, m0, m1, m2)
+				SHA1NI_ROUNDS(3, e0, e1, m0, m1, m2, m3)
+
+				/* Rounds 68 to 79.
+				 */
+				e1   = _mm_sha1nexte_epu32(e1, m1);
+				e0   = abcd;
+				m2   = _mm_sha1msg2_epu32(m2, m1);
+				abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+				m3   = _mm_xor_si128(m3, m1);
+
+				e0   = _mm_sha1nexte_epu32(e0, m2);
+				e1   = abcd;
+				m3   = _mm_sha1msg2_epu32(m3, m2);
+				abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+				e1   = _mm_sha1nexte_epu32(e1, m3);
+				e0   = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+				/* Add this block's hash to the result.
+				 */
+				e0   = _mm_sha1nexte_epu32(e0, eSave);
+				abcd = _mm_add_epi32(abcd, abcdSave);
+			}
+
+			_mm_storeu_si128((__m128i *) state, _mm_shuffle_epi32(abcd, 0x1B));
+
+			state[4] = _mm_extract_epi32(e0, 3);
+		}
+
+#undef SHA1NI_ROUNDS
+#endif
+
+		/* Use portable implementations until CPU detection ran.
+		 */
+		HashBlocksKernel		 MD5Blocks    = NIL;
+		HashBlocksKernel		 SHA1Blocks   = NIL;
+
+		HashMultipleKernel		 MD5Multiple  = NIL;
+		HashMultipleKernel		 SHA1Multiple = NIL;
+	};
+};
+
+S::Int	 addHashInitTmp = S::AddInitFunction(&S::Hash::SelectHashKernels);
+
+S::Int S::Hash::SelectHashKernels()
+{
+#ifdef SMOOTH_SIMD_X86
+	System::CPU	 cpu;
+
+	if	(cpu.HasSHA() && cpu.HasSSE4_1()) SHA1Blocks = &SHA1BlocksSHA;
+	else if (cpu.HasSSSE3())		  SHA1Blocks = &SHA1BlocksSSSE3;
+
+	if	(cpu.HasAVX2()) MD5Multiple = &MD5MultipleAVX2;
+	else if (cpu.HasSSE2()) MD5Multiple = &MD5MultipleSSE2;
+
+	/* Hashing messages one after another is faster
+	 * than multiple lanes with the SHA extensions.
+	 */
+	if (SHA1Blocks != &SHA1BlocksSHA)
+	{
+		if	(cpu.HasAVX2()) SHA1Multiple = &SHA1MultipleAVX2;
+		else if (cpu.HasSSE2()) SHA1Multiple = &SHA1MultipleSSE2;
+	}
+#endif
+
+	return Success();
+}
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2018 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -12,7 +12,19 @@
   * Inc. MD5 Message-Digest Algorithm. */
 
 #include <smooth/misc/hash/md5.h>
-#include <smooth/misc/number.h>
+#include <smooth/misc/math.h>
+
+namespace smooth
+{
+	namespace Hash
+	{
+		typedef Void (*HashBlocksKernel)(UnsignedInt32 *, const UnsignedByte *, Int);
+		typedef Bool (*HashMultipleKernel)(const UnsignedByte * const *, const Int *, Int, UnsignedByte *);
+
+		extern HashBlocksKernel		 MD5Blocks;
+		extern HashMultipleKernel	 MD5Multiple;
+	};
+};
 
 /* Constants for MD5Transform routine.
  */
@@ -79,13 +91,6 @@ static unsigned char PADDING[64] = {
 			 (b)[4 * (x) + 2] << 16 |			\
 			 (b)[4 * (x) + 3] << 24)
 
-/* REVERSE_INT32 changes the byte order of an integer.
- */
-#define REVERSE_INT32(x) ((( (x)	& 0xFF) << 24) |			\
-			  ((((x) >>  8) & 0xFF) << 16) |			\
-			  ((((x) >> 16) & 0xFF) <<  8) |			\
-			   (((x) >> 24) & 0xFF)	      )
-
 S::Hash::MD5::MD5()
 {
 	Reset();
@@ -95,7 +100,7 @@ S::Hash::MD5::~MD5()
 {
 }
 
-S::Void S::Hash::MD5::Transform(UnsignedByte *data)
+S::Void S::Hash::MD5::Transform(UnsignedInt32 *state, const UnsignedByte *data)
 {
 	UnsignedInt32	 a = state[0];
 	UnsignedInt32	 b = state[1];
@@ -179,7 +184,14 @@ S::Void S::Hash::MD5::Transform(UnsignedByte *data)
 	state[2] += c;
 	state[3] += d;
 
-	size += 64;
+}
+
+S::Void S::Hash::MD5::ProcessBlocks(const UnsignedByte *data, Int blocks)
+{
+	if (MD5Blocks != NIL) MD5Blocks(state, data, blocks);
+	else		      for (Int i = 0; i < blocks; i++) Transform(state, data + 64 * i);
+
+	size += 64 * blocks;
 }
 
 S::Bool S::Hash::MD5::Reset()
@@ -198,15 +210,33 @@ S::Bool S::Hash::MD5::Reset()
 
 S::Bool S::Hash::MD5::Feed(const UnsignedByte *data, Int size)
 {
-	buffer.Resize(buffer.Size() + size);
+	/* Complete a previously buffered partial block.
+	 */
+	Int	 index = buffer.Size();
 
-	memcpy(buffer + buffer.Size() - size, data, size);
+	if (index > 0)
+	{
+		Int	 count = Math::Min(size, 64 - index);
 
-	for (Int i = 0; i + 63 < buffer.Size(); i += 64) Transform(buffer + i);
+		buffer.Resize(index + count);
 
-	memcpy(buffer, buffer + buffer.Size() - buffer.Size() % 64, buffer.Size() % 64);
+		memcpy(buffer + index, data, count);
 
-	buffer.Resize(buffer.Size() % 64);
+		data += count;
+		size -= count;
+
+		if (buffer.Size() < 64) return True;
+
+		ProcessBlocks(buffer, 1);
+	}
+
+	/* Process full blocks in place and buffer the rest.
+	 */
+	if (size >= 64) ProcessBlocks(data, size / 64);
+
+	buffer.Resize(size % 64);
+
+	if (size % 64 > 0) memcpy(buffer, data + size - size % 64, size % 64);
 
 	return True;
 }
@@ -216,7 +246,7 @@ S::Bool S::Hash::MD5::Feed(const Buffer<UnsignedByte> &data)
 	return Feed(data, data.Size());
 }
 
-S::String S::Hash::MD5::Finish()
+S::Bool S::Hash::MD5::Finish(UnsignedByte *digest)
 {
 	UnsignedInt64	 bits	= (buffer.Size() + size) * 8;
 	Int		 index	= buffer.Size();
@@ -225,29 +255,39 @@ S::String S::Hash::MD5::Finish()
 	 */
 	Int		 padLen	= (index < 56) ? (56 - index) : (120 - index);
 
-	UnsignedByte	*end = new UnsignedByte [128];
+	UnsignedByte	 end[128];
+
+	if (index > 0) memcpy(end, buffer, index);
 
-	memcpy(end, buffer, index);
 	memcpy(end + index, PADDING, padLen);
 
-	end[index + padLen    ] = bits	     & 0xFF;
-	end[index + padLen + 1] = bits >>  8 & 0xFF;
-	end[index + padLen + 2] = bits >> 16 & 0xFF;
-	end[index + padLen + 3] = bits >> 24 & 0xFF;
-	end[index + padLen + 4] = bits >> 32 & 0xFF;
-	end[index + padLen + 5] = bits >> 40 & 0xFF;
-	end[index + padLen + 6] = bits >> 48 & 0xFF;
-	end[index + padLen + 7] = bits >> 56 & 0xFF;
+	for (Int i = 0; i < 8; i++) end[index + padLen + i] = bits >> 8 * i & 0xFF;
 
-	Transform(end);
+	ProcessBlocks(end, padLen > 56 ? 2 : 1);
 
-	if (padLen > 56) Transform(end + 64);
+	buffer.Resize(0);
 
-	delete [] end;
+	for (Int i = 0; i < 16; i++) digest[i] = state[i / 4] >> 8 * (i % 4) & 0xFF;
 
-	String	 string;
+	return True;
+}
+
+S::String S::Hash::MD5::Finish()
+{
+	static const char	*hex = "0123456789abcdef";
+
+	UnsignedByte	 digest[DigestSize];
+	char		 string[2 * DigestSize + 1];
+
+	Finish(digest);
+
+	for (Int i = 0; i < DigestSize; i++)
+	{
+		string[2 * i	] = hex[digest[i] >> 4];
+		string[2 * i + 1] = hex[digest[i] & 15];
+	}
 
-	for (Int i = 0; i < 4; i++) string.Append(Number((Int64) REVERSE_INT32(state[i])).ToHexString(8));
+	string[2 * DigestSize] = 0;
 
 	return string;
 }
@@ -265,3 +305,20 @@ S::String S::Hash::MD5::Compute(const Buffer<UnsignedByte> &data)
 {
 	return Compute(data, data.Size());
 }
+
+S::Bool S::Hash::MD5::Compute(const UnsignedByte * const *data, const Int *sizes, Int count, UnsignedByte *digests)
+{
+	/* Hash messages in parallel if a multi-buffer kernel is available.
+	 */
+	if (MD5Multiple != NIL) return MD5Multiple(data, sizes, count, digests);
+
+	for (Int i = 0; i < count; i++)
+	{
+		MD5	 md5;
+
+		md5.Feed(data[i], sizes[i]);
+		md5.Finish(digests + i * DigestSize);
+	}
+
+	return True;
+}
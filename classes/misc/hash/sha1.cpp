@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2018 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -9,7 +9,19 @@
   * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
 
 #include <smooth/misc/hash/sha1.h>
-#include <smooth/misc/number.h>
+#include <smooth/misc/math.h>
+
+namespace smooth
+{
+	namespace Hash
+	{
+		typedef Void (*HashBlocksKernel)(UnsignedInt32 *, const UnsignedByte *, Int);
+		typedef Bool (*HashMultipleKernel)(const UnsignedByte * const *, const Int *, Int, UnsignedByte *);
+
+		extern HashBlocksKernel		 SHA1Blocks;
+		extern HashMultipleKernel	 SHA1Multiple;
+	};
+};
 
 /* SHA-1 padding bytes.
  */
@@ -33,11 +45,11 @@ S::Hash::SHA1::~SHA1()
 {
 }
 
-S::Void S::Hash::SHA1::Transform(UnsignedByte *buffer)
+S::Void S::Hash::SHA1::Transform(UnsignedInt32 *state, const UnsignedByte *data)
 {
 	UnsignedInt32	 word[80];
 
-	for (Int j =  0; j < 16; j++) word[j] = buffer[j * 4 + 0] * 0x1000000 + buffer[j * 4 + 1] * 0x10000 + buffer[j * 4 + 2] * 0x100 + buffer[j * 4 + 3];
+	for (Int j =  0; j < 16; j++) word[j] = data[j * 4 + 0] * 0x1000000 + data[j * 4 + 1] * 0x10000 + data[j * 4 + 2] * 0x100 + data[j * 4 + 3];
 	for (Int j = 16; j < 80; j++) word[j] = ROTATE_LEFT((word[j - 3] ^ word[j - 8] ^ word[j - 14] ^ word[j - 16]), 1);
 
 	UnsignedInt32	 a = state[0];
@@ -72,7 +84,14 @@ S::Void S::Hash::SHA1::Transform(UnsignedByte *buffer)
 	state[3] += d;
 	state[4] += e;
 
-	size += 64;
+}
+
+S::Void S::Hash::SHA1::ProcessBlocks(const UnsignedByte *data, Int blocks)
+{
+	if (SHA1Blocks != NIL) SHA1Blocks(state, data, blocks);
+	else		       for (Int i = 0; i < blocks; i++) Transform(state, data + 64 * i);
+
+	size += 64 * blocks;
 }
 
 S::Bool S::Hash::SHA1::Reset()
@@ -92,15 +111,33 @@ S::Bool S::Hash::SHA1::Reset()
 
 S::Bool S::Hash::SHA1::Feed(const UnsignedByte *data, Int size)
 {
-	buffer.Resize(buffer.Size() + size);
+	/* Complete a previously buffered partial block.
+	 */
+	Int	 index = buffer.Size();
 
-	memcpy(buffer + buffer.Size() - size, data, size);
+	if (index > 0)
+	{
+		Int	 count = Math::Min(size, 64 - index);
+
+		buffer.Resize(index + count);
+
+		memcpy(buffer + index, data, count);
+
+		data += count;
+		size -= count;
+
+		if (buffer.Size() < 64) return True;
 
-	for (Int i = 0; i + 63 < buffer.Size(); i += 64) Transform(buffer + i);
+		ProcessBlocks(buffer, 1);
+	}
+
+	/* Process full blocks in place and buffer the rest.
+	 */
+	if (size >= 64) ProcessBlocks(data, size / 64);
 
-	memcpy(buffer, buffer + buffer.Size() - buffer.Size() % 64, buffer.Size() % 64);
+	buffer.Resize(size % 64);
 
-	buffer.Resize(buffer.Size() % 64);
+	if (size % 64 > 0) memcpy(buffer, data + size - size % 64, size % 64);
 
 	return True;
 }
@@ -110,7 +147,7 @@ S::Bool S::Hash::SHA1::Feed(const Buffer<UnsignedByte> &data)
 	return Feed(data, data.Size());
 }
 
-S::String S::Hash::SHA1::Finish()
+S::Bool S::Hash::SHA1::Finish(UnsignedByte *digest)
 {
 	UnsignedInt64	 bits	= (buffer.Size() + size) * 8;
 	Int		 index	= buffer.Size();
@@ -119,22 +156,39 @@ S::String S::Hash::SHA1::Finish()
 	 */
 	Int		 padLen	= (index < 56) ? (56 - index) : (120 - index);
 
-	UnsignedByte	*end = new UnsignedByte [128];
+	UnsignedByte	 end[128];
+
+	if (index > 0) memcpy(end, buffer, index);
 
-	memcpy(end, buffer, index);
 	memcpy(end + index, PADDING, padLen);
 
 	for (Int i = 0; i < 8; i++) end[index + padLen + i] = bits >> 8 * (7 - i) & 0xFF;
 
-	Transform(end);
+	ProcessBlocks(end, padLen > 56 ? 2 : 1);
 
-	if (padLen > 56) Transform(end + 64);
+	buffer.Resize(0);
 
-	delete [] end;
+	for (Int i = 0; i < 20; i++) digest[i] = state[i / 4] >> 8 * (3 - i % 4) & 0xFF;
 
-	String	 string;
+	return True;
+}
+
+S::String S::Hash::SHA1::Finish()
+{
+	static const char	*hex = "0123456789abcdef";
+
+	UnsignedByte	 digest[DigestSize];
+	char		 string[2 * DigestSize + 1];
+
+	Finish(digest);
+
+	for (Int i = 0; i < DigestSize; i++)
+	{
+		string[2 * i	] = hex[digest[i] >> 4];
+		string[2 * i + 1] = hex[digest[i] & 15];
+	}
 
-	for (Int i = 0; i < 5; i++) string.Append(Number((Int64) ((UnsignedInt32 *) state)[i]).ToHexString(8));
+	string[2 * DigestSize] = 0;
 
 	return string;
 }
@@ -152,3 +206,20 @@ S::String S::Hash::SHA1::Compute(const Buffer<UnsignedByte> &data)
 {
 	return Compute(data, data.Size());
 }
+
+S::Bool S::Hash::SHA1::Compute(const UnsignedByte * const *data, const Int *sizes, Int count, UnsignedByte *digests)
+{
+	/* Hash messages in parallel if a multi-buffer kernel is available.
+	 */
+	if (SHA1Multiple != NIL) return SHA1Multiple(data, sizes, count, digests);
+
+	for (Int i = 0; i < count; i++)
+	{
+		SHA1	 sha1;
+
+		sha1.Feed(data[i], sizes[i]);
+		sha1.Finish(digests + i * DigestSize);
+	}
+
+	return True;
+}
@@ -0,0 +1,151 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/misc/hash/wyhash.h>
+
+#include <time.h>
+
+const S::UnsignedInt64	 S::Hash::WyHash::secret[4] = { 0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL, 0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL };
+
+namespace smooth
+{
+	/* Read values in little endian byte order.
+	 */
+	static inline UnsignedInt64 Read8(const UnsignedByte *p)
+	{
+		return (UnsignedInt64) p[0]	  | (UnsignedInt64) p[1] <<  8 | (UnsignedInt64) p[2] << 16 | (UnsignedInt64) p[3] << 24 |
+		       (UnsignedInt64) p[4] << 32 | (UnsignedInt64) p[5] << 40 | (UnsignedInt64) p[6] << 48 | (UnsignedInt64) p[7] << 56;
+	}
+
+	static inline UnsignedInt64 Read4(const UnsignedByte *p)
+	{
+		return (UnsignedInt64) p[0] | (UnsignedInt64) p[1] << 8 | (UnsignedInt64) p[2] << 16 | (UnsignedInt64) p[3] << 24;
+	}
+
+	static inline UnsignedInt64 Read3(const UnsignedByte *p, Int size)
+	{
+		return (UnsignedInt64) p[0] << 16 | (UnsignedInt64) p[size >> 1] << 8 | p[size - 1];
+	}
+};
+
+S::UnsignedInt64 S::Hash::WyHash::InitSeed()
+{
+	/* Combine time and addresses, which are
+	 * randomized on most modern systems.
+	 */
+	UnsignedInt64	 seed = Mix((UnsignedInt64) time(NIL) ^ secret[2], (UnsignedInt64) clock() ^ secret[3]);
+
+	seed = Mix(seed ^ (UnsignedInt64) (size_t) &secret, secret[1]);
+	seed = Mix(seed ^ (UnsignedInt64) (size_t) &seed, secret[0]);
+
+	return seed;
+}
+
+S::UnsignedInt64 S::Hash::WyHash::GetRandomSeed()
+{
+	/* Initialize on first use, so hash tables
+	 * constructed statically get a random seed too.
+	 */
+	static UnsignedInt64	 randomSeed = InitSeed();
+
+	return randomSeed;
+}
+
+S::UnsignedInt64 S::Hash::WyHash::Compute(const UnsignedByte *data, Int size, UnsignedInt64 seed)
+{
+	const UnsignedByte	*p = data;
+	UnsignedInt64		 a = 0;
+	UnsignedInt64		 b = 0;
+
+	seed ^= Mix(seed ^ secret[0], secret[1]);
+
+	if (size <= 16)
+	{
+		if (size >= 4)
+		{
+			a = (Read4(p) << 32) | Read4(p + ((size >> 3) << 2));
+			b = (Read4(p + size - 4) << 32) | Read4(p + size - 4 - ((size >> 3) << 2));
+		}
+		else if (size > 0)
+		{
+			a = Read3(p, size);
+		}
+	}
+	else
+	{
+		Int	 i = size;
+
+		/* Process 48 byte blocks in three independent lanes.
+		 */
+		if (i > 48)
+		{
+			UnsignedInt64	 seed1 = seed;
+			UnsignedInt64	 seed2 = seed;
+
+			do
+			{
+				seed  = Mix(Read8(p)	  ^ secret[1], Read8(p +  8) ^ seed);
+				seed1 = Mix(Read8(p + 16) ^ secret[2], Read8(p + 24) ^ seed1);
+				seed2 = Mix(Read8(p + 32) ^ secret[3], Read8(p + 40) ^ seed2);
+
+				p += 48;
+				i -= 48;
+			}
+			while (i > 48);
+
+			seed ^= seed1 ^ seed2;
+		}
+
+		while (i > 16)
+		{
+			seed = Mix(Read8(p) ^ secret[1], Read8(p + 8) ^ seed);
+
+			p += 16;
+			i -= 16;
+		}
+
+		a = Read8(p + i - 16);
+		b = Read8(p + i - 8);
+	}
+
+	a ^= secret[1];
+	b ^= seed;
+
+	/* Full 128 bit product of a and b.
+	 */
+#if defined __SIZEOF_INT128__
+	unsigned __int128	 r = (unsigned __int128) a * b;
+
+	a = (UnsignedInt64) r;
+	b = (UnsignedInt64) (r >> 64);
+#elif defined _MSC_VER && defined _M_X64
+	a = _umul128(a, b, &b);
+#else
+	UnsignedInt64	 ha = a >> 32, la = (UnsignedInt32) a;
+	UnsignedInt64	 hb = b >> 32, lb = (UnsignedInt32) b;
+
+	UnsignedInt64	 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	UnsignedInt64	 t  = rl + (rm0 << 32);
+	UnsignedInt64	 c  = t < rl;
+	UnsignedInt64	 lo = t + (rm1 << 32);
+
+	c += lo < t;
+
+	a = lo;
+	b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+
+	return Mix(a ^ secret[0] ^ size, b ^ secret[1]);
+}
+
+S::UnsignedInt64 S::Hash::WyHash::Compute(const Buffer<UnsignedByte> &buffer, UnsignedInt64 seed)
+{
+	return Compute(buffer, buffer.Size(), seed);
+}
@@ -0,0 +1,170 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/misc/hashindex.h>
+#include <smooth/misc/hash/wyhash.h>
+
+namespace smooth
+{
+	/* Minimum size of the slot table.
+	 */
+	static const Int	 minTableSize = 16;
+};
+
+S::HashIndex::HashIndex()
+{
+	nOfEntries     = 0;
+
+	seed	       = Hash::WyHash::GetRandomSeed();
+
+	tableMask      = -1;
+
+	lockingEnabled = False;
+	lock	       = NIL;
+}
+
+S::HashIndex::~HashIndex()
+{
+	if (lock != NIL)
+	{
+		delete lock;
+
+		lock = NIL;
+	}
+}
+
+S::Bool S::HashIndex::RemoveAll()
+{
+	WriteLock	 lock(*this);
+
+	if (nOfEntries == 0 && tableMask == -1) return True;
+
+	hashes.Free();
+	table.Free();
+
+	nOfEntries = 0;
+	tableMask   = -1;
+
+	return True;
+}
+
+S::Int S::HashIndex::GetSlotByEntry(Int entry) const
+{
+	Int	 slot = hashes[entry] & tableMask;
+
+	while (table[slot] != entry) slot = (slot + 1) & tableMask;
+
+	return slot;
+}
+
+S::Void S::HashIndex::Rebuild(Int capacity)
+{
+	/* Keep load factor at or below three quarters.
+	 */
+	Int	 size = minTableSize;
+
+	while (size * 3 < capacity * 4) size <<= 1;
+
+	table.Resize(size);
+
+	tableMask = size - 1;
+
+	for (Int i = 0; i < size; i++) table[i] = -1;
+
+	for (Int i = 0; i < nOfEntries; i++)
+	{
+		Int	 slot = hashes[i] & tableMask;
+
+		while (table[slot] != -1) slot = (slot + 1) & tableMask;
+
+		table[slot] = i;
+	}
+}
+
+S::Int S::HashIndex::InsertEntry(UnsignedInt64 hash)
+{
+	if ((nOfEntries + 1) * 4 > (tableMask + 1) * 3) Rebuild(nOfEntries + 1);
+
+	if (hashes.Size() == nOfEntries) hashes.Resize(8 > nOfEntries * 1.25 ? 8 : nOfEntries * 1.25);
+
+	hashes[nOfEntries] = hash;
+
+	Int	 slot = hash & tableMask;
+
+	while (table[slot] != -1) slot = (slot + 1) & tableMask;
+
+	table[slot] = nOfEntries;
+
+	return nOfEntries++;
+}
+
+S::Void S::HashIndex::RemoveEntry(Int entry)
+{
+	Int	 slot = GetSlotByEntry(entry);
+
+	/* Shift following entries back to close the gap
+	 * instead of leaving a tombstone.
+	 */
+	for (Int next = (slot + 1) & tableMask; table[next] != -1; next = (next + 1) & tableMask)
+	{
+		Int	 home = hashes[table[next]] & tableMask;
+
+		if (slot <= next ? (slot < home && home <= next) : (slot < home || home <= next)) continue;
+
+		table[slot] = table[next];
+
+		slot = next;
+	}
+
+	table[slot] = -1;
+
+	/* Move last entry into the free place.
+	 */
+	if (entry != --nOfEntries)
+	{
+		table[GetSlotByEntry(nOfEntries)] = entry;
+
+		hashes[entry] = hashes[nOfEntries];
+	}
+}
+
+S::Void S::HashIndex::Swap(HashIndex &oIndex)
+{
+	Int		 oNOfEntries = oIndex.nOfEntries;
+	UnsignedInt64	 oSeed	     = oIndex.seed;
+	Int		 oTableMask  = oIndex.tableMask;
+
+	oIndex.nOfEntries = nOfEntries;
+	oIndex.seed	  = seed;
+	oIndex.tableMask  = tableMask;
+
+	nOfEntries = oNOfEntries;
+	seed	   = oSeed;
+	tableMask  = oTableMask;
+
+	hashes.Swap(oIndex.hashes);
+	table.Swap(oIndex.table);
+}
+
+S::Bool S::HashIndex::EnableLocking() const
+{
+	lockingEnabled = True;
+
+	if (lock == NIL) lock = new Threads::RWLock();
+
+	return True;
+}
+
+S::Bool S::HashIndex::DisableLocking() const
+{
+	lockingEnabled = False;
+
+	return True;
+}
@@ -0,0 +1,44 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_SIMD
+#define H_OBJSMOOTH_SIMD
+
+#include <smooth/definitions.h>
+
+/* Common definitions for SIMD kernels, not part of the public API.
+ *
+ * On x86, kernels are compiled for instruction sets that are not
+ * enabled globally by marking them with SMOOTH_TARGET and are only
+ * selected after CPU detection ran. SMOOTH_SIMD_SSE2 tells whether
+ * SSE2 is enabled globally, so SSE2 kernels may be used right away.
+ *
+ * NEON is always available on AArch64, so NEON kernels are used
+ * right away without waiting for CPU detection.
+ */
+#if defined __i386__ || defined __x86_64__ || defined _M_IX86 || defined _M_X64
+#	define SMOOTH_SIMD_X86
+#	include <immintrin.h>
+
+#	if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#		define SMOOTH_SIMD_SSE2
+#	endif
+#elif defined __aarch64__ || defined _M_ARM64
+#	define SMOOTH_SIMD_NEON
+#	include <arm_neon.h>
+#endif
+
+#if defined __GNUC__
+#	define SMOOTH_TARGET(name) __attribute__((target(name)))
+#else
+#	define SMOOTH_TARGET(name)
+#endif
+
+#endif
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -9,15 +9,20 @@
   * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
 
 #include <smooth/misc/string.h>
+#include <smooth/misc/stringbuilder.h>
+#include <smooth/misc/stringview.h>
 #include <smooth/misc/number.h>
 #include <smooth/misc/math.h>
 #include <smooth/misc/encoding/base64.h>
 #include <smooth/misc/hash/crc32.h>
 #include <smooth/misc/hash/crc64.h>
+#include <smooth/misc/hash/wyhash.h>
 #include <smooth/templates/buffer.h>
 #include <smooth/templates/threadlocal.h>
 #include <smooth/init.h>
 
+#include "string_internal.h"
+
 #include <iconv.h>
 #include <wchar.h>
 #include <memory.h>
@@ -29,17 +34,76 @@
 
 namespace smooth
 {
-	typedef Array<char *, Void *>		 BufferArray;
+	/* Per thread ring of buffers returned by ConvertTo.
+	 */
+	class TemporaryBuffers
+	{
+		public:
+			static const Int	 Size = 8;
+
+			char			*buffers[Size];
 
-	static multithread (BufferArray *)	 allocatedBuffers = NIL;
+			Int			 next;
+
+						 TemporaryBuffers() : next(0) { for (Int i = 0; i < Size; i++) buffers[i] = NIL; }
+						~TemporaryBuffers() { for (Int i = 0; i < Size; i++) delete [] buffers[i]; }
+	};
+
+	static multithread (TemporaryBuffers *)	 allocatedBuffers = NIL;
 	static multithread (Buffer<char> *)	 iconvBuffer	  = NIL;
 
+	/* Per thread cache of iconv conversion descriptors.
+	 */
+	class IconvCache
+	{
+		public:
+			static const Int	 Size = 8;
+
+			char			 inEncodings[Size][32];
+			char			 outEncodings[Size][32];
+
+			iconv_t			 descriptors[Size];
+
+			Int			 nOfDescriptors;
+			Int			 next;
+
+						 IconvCache() : nOfDescriptors(0), next(0) { }
+						~IconvCache() { for (Int i = 0; i < nOfDescriptors; i++) iconv_close(descriptors[i]); }
+	};
+
+	static multithread (IconvCache *)	 iconvCache	  = NIL;
+
 	static multithread (char *)		 inputFormat	  = NIL;
 	static multithread (char *)		 outputFormat	  = NIL;
 
 	static Bool				 initialized	  = False;
 
 	Int					 ConvertString(const char *, Int, const char *, char *, Int, const char *);
+
+	static iconv_t				 OpenIconv(const char *, const char *, Bool &);
+
+	/* Encodings supported by the built-in converters.
+	 */
+	enum NativeEncoding
+	{
+		NATIVE_NONE = 0,
+		NATIVE_UTF8,
+		NATIVE_LATIN1,
+		NATIVE_UTF16LE,
+		NATIVE_UTF16BE,
+		NATIVE_UTF32LE,
+		NATIVE_UTF32BE
+	};
+
+	static Int				 GetNativeEncoding(const char *);
+	static Int				 ConvertNative(const char *, Int, Int, char *, Int, Int);
+
+	static inline wchar_t FoldCase(wchar_t c)
+	{
+		if (c < 0x80) return (c >= 'A' && c <= 'Z') ? c | 0x20 : c;
+
+		return MapCase(c, CASE_FOLD);
+	}
 };
 
 S::Int	 addStringInitTmp = S::AddInitFunction(&S::String::Initialize);
@@ -47,23 +111,47 @@ S::Int	 addStringFreeTmp = S::AddFreeFunction(&S::String::Free);
 
 S::String::String(const int nil)
 {
+	stringLength = 0;
+	writeIndex   = -1;
 }
 
 S::String::String(const char *iString)
 {
+	stringLength = 0;
+	writeIndex   = -1;
+
 	*this = iString;
 }
 
 S::String::String(const wchar_t *iString)
 {
+	stringLength = 0;
+	writeIndex   = -1;
+
 	*this = iString;
 }
 
 S::String::String(const String &iString)
 {
+	stringLength = 0;
+	writeIndex   = -1;
+
 	*this = iString;
 }
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+S::String::String(String &&iString)
+{
+	stringLength = iString.stringLength;
+	writeIndex   = iString.writeIndex;
+
+	wString.Swap(iString.wString);
+
+	iString.stringLength = 0;
+	iString.writeIndex   = -1;
+}
+#endif
+
 S::String::~String()
 {
 }
@@ -72,6 +160,8 @@ S::Int S::String::Initialize()
 {
 	initialized = True;
 
+	SelectStringKernels();
+
 	return Success();
 }
 
@@ -115,55 +205,60 @@ const char *S::String::GetDefaultEncoding()
 
 S::Void S::String::AddTemporaryBuffer(char *buffer)
 {
-	/* Free old buffers and add new.
+	/* Replace the oldest buffer with the new one.
 	 */
-	if (allocatedBuffers == NIL) allocatedBuffers = new BufferArray();
+	if (allocatedBuffers == NIL) allocatedBuffers = new TemporaryBuffers();
 
-	if (allocatedBuffers->Length() >= 8) DeleteTemporaryBuffers();
+	Int	 slot = allocatedBuffers->next;
 
-	allocatedBuffers->Add(buffer);
+	delete [] allocatedBuffers->buffers[slot];
+
+	allocatedBuffers->buffers[slot] = buffer;
+	allocatedBuffers->next		= (slot + 1) % TemporaryBuffers::Size;
 }
 
 S::Void S::String::DeleteTemporaryBuffers(Bool all)
 {
-	/* Free all but the most recent 8 buffers.
+	/* Buffers are replaced in AddTemporaryBuffer,
+	 * so there is only work to do when purging all.
 	 */
-	if (allocatedBuffers != NIL)
-	{
-		Int	 nOfEntries = allocatedBuffers->Length();
-
-		for (Int i = 0; i < nOfEntries - (all ? 0 : 8); i++)
-		{
-			delete [] allocatedBuffers->GetFirst();
+	if (!all) return;
 
-			allocatedBuffers->RemoveNth(0);
-		}
-
-		if (all)
-		{
-			delete allocatedBuffers;
+	if (allocatedBuffers != NIL) delete allocatedBuffers;
 
-			allocatedBuffers = NIL;
-		}
-	}
+	allocatedBuffers = NIL;
 
-	/* When purging all, also free iconv buffer and I/O format strings.
+	/* Also free iconv buffer and I/O format strings.
 	 */
-	if (all)
-	{
-		if (iconvBuffer) delete iconvBuffer;
+	if (iconvBuffer != NIL) delete iconvBuffer;
+	if (iconvCache	!= NIL) delete iconvCache;
 
-		if (inputFormat	 != NIL) delete [] inputFormat;
-		if (outputFormat != NIL) delete [] outputFormat;
+	iconvBuffer = NIL;
+	iconvCache  = NIL;
 
-		inputFormat  = NIL;
-		outputFormat = NIL;
-	}
+	if (inputFormat	 != NIL) delete [] inputFormat;
+	if (outputFormat != NIL) delete [] outputFormat;
+
+	inputFormat  = NIL;
+	outputFormat = NIL;
 }
 
 S::Void S::String::Clean()
 {
 	wString.Resize(0);
+
+	stringLength = 0;
+	writeIndex   = -1;
+}
+
+S::Void S::String::Reserve(Int size)
+{
+	/* Grow buffer geometrically to make
+	 * repeated appends amortized O(1).
+	 */
+	if (size <= wString.Size()) return;
+
+	wString.Resize(Math::Max(size, wString.Size() + wString.Size() / 2));
 }
 
 S::UnsignedInt32 S::String::ComputeCRC32() const
@@ -180,6 +275,39 @@ S::UnsignedInt64 S::String::ComputeCRC64() const
 	return Hash::CRC64::Compute((UnsignedByte *) (wchar_t *) wString, Length() * sizeof(wchar_t));
 }
 
+S::UnsignedInt64 S::String::ComputeHash(UnsignedInt64 seed) const
+{
+	if (wString.Size() == 0) return Hash::WyHash::Compute(NIL, 0, seed);
+
+	return Hash::WyHash::Compute((UnsignedByte *) (wchar_t *) wString, Length() * sizeof(wchar_t), seed);
+}
+
+S::UnsignedInt64 S::String::HashIgnoreCase(UnsignedInt64 seed) const
+{
+	Int	 length = Length();
+
+	if (length == 0) return Hash::WyHash::Compute(NIL, 0, seed);
+
+	/* Hash folded characters in blocks to avoid creating a
+	 * temporary string, seeding each block with the hash of
+	 * the previous ones. Strings of up to 256 characters hash
+	 * like their folded version does with ComputeHash.
+	 */
+	UnsignedInt64	 hash = seed;
+	wchar_t		 block[256];
+
+	for (Int i = 0; i < length; i += 256)
+	{
+		Int	 count = Math::Min(length - i, 256);
+
+		for (Int n = 0; n < count; n++) block[n] = FoldCase(wString[i + n]);
+
+		hash = Hash::WyHash::Compute((UnsignedByte *) block, count * sizeof(wchar_t), hash);
+	}
+
+	return hash;
+}
+
 S::String S::String::EncodeBase64() const
 {
 	if (wString.Size() == 0) return NIL;
@@ -215,16 +343,9 @@ S::Bool S::String::IsANSI(const String &string)
 
 S::Bool S::String::IsUnicode(const String &string)
 {
-	const wchar_t	*chars	= string;
-	Int		 length = string.Length();
-
-	for (Int i = 0; i < length; i++)
-	{
-		if ( chars[i] <	 0x20 || chars[i] > 0xFF ||
-		    (chars[i] >= 0x80 && chars[i] < 0xA0)) return True;
-	}
+	Int	 length = string.Length();
 
-	return False;
+	return ScanANSI(string, length) < length;
 }
 
 const char *S::String::GetInputFormat()
@@ -353,6 +474,42 @@ S::Int S::String::ImportFrom(const char *format, const char *str)
 	else if (width == 2) while (true) { if (((short *) str)[++length] == 0) { length *= 2; break; } }
 	else if (width == 4) while (true) { if (((int   *) str)[++length] == 0) { length *= 4; break; } }
 
+	/* Widen pure ASCII input directly without going through iconv.
+	 */
+	if (width == 1 && IsASCIICompatible(format))
+	{
+		wString.Resize(length + 1);
+
+		if (WidenASCII(str, wString, length + 1) == length + 1)
+		{
+			stringLength = length;
+
+			return Success();
+		}
+	}
+
+	/* Use built-in converters in a single pass if possible. Input
+	 * bytes are an upper bound for the number of output characters.
+	 */
+	Int	 nativeIn	= GetNativeEncoding(format);
+	Int	 nativeInternal = GetNativeEncoding(GetInternalFormat());
+
+	if (nativeIn != NATIVE_NONE && nativeInternal != NATIVE_NONE)
+	{
+		wString.Resize(length + 1);
+
+		Int	 size = ConvertNative(str, length, nativeIn, (char *) (wchar_t *) wString, length * sizeof(wchar_t), nativeInternal);
+
+		if (size >= 0)
+		{
+			stringLength = size / sizeof(wchar_t);
+
+			wString[stringLength] = 0;
+
+			return Success();
+		}
+	}
+
 	Int	 size = ConvertString(str, length, format, NIL, 0, GetInternalFormat());
 
 	if	(size < 0 && strcmp(format, "ISO-8859-1") != 0) return ImportFrom("ISO-8859-1", str);
@@ -366,6 +523,8 @@ S::Int S::String::ImportFrom(const char *format, const char *str)
 
 	wString[size - 1] = 0;
 
+	stringLength = -1;
+
 	return Success();
 }
 
@@ -375,34 +534,104 @@ char *S::String::ConvertTo(const char *encoding) const
 
 	if (size == 1) return NIL;
 
-	Int	 bufferSize = ConvertString((char *) (wchar_t *) wString, size * sizeof(wchar_t), GetInternalFormat(), NIL, 0, encoding);
+	/* Try with a buffer fitting single byte encodings first.
+	 */
+	char	*buffer = new char [size];
+	Int	 needed = ConvertTo(encoding, buffer, size);
+
+	if (needed > size)
+	{
+		delete [] buffer;
 
-	if (bufferSize == -1) bufferSize = ConvertString((char *) (wchar_t *) wString, size * sizeof(wchar_t), GetInternalFormat(), NIL, 0, "ISO-8859-1");
+		buffer = new char [needed];
 
-	char	*buffer = NIL;
+		ConvertTo(encoding, buffer, needed);
+	}
 
-	if (bufferSize <= 0)
+	AddTemporaryBuffer(buffer);
+
+	return buffer;
+}
+
+S::Int S::String::ConvertTo(const char *encoding, char *buffer, Int size) const
+{
+	static const wchar_t	 empty = 0;
+
+	Int			 length = Length();
+
+	/* Narrow pure ASCII strings directly if
+	 * the target encoding is a superset of ASCII.
+	 */
+	if (length > 0 && size > length && IsASCIICompatible(encoding))
 	{
-		Int	 length = Length();
+		if (NarrowASCII(wString, buffer, length + 1) == length + 1) return length + 1;
+	}
 
-		buffer = new char [length + 1];
+	const char	*chars = (length > 0 ? (char *) (wchar_t *) wString : (char *) &empty);
+	Int		 bytes = (length + 1) * sizeof(wchar_t);
 
-		ConvertString((char *) (wchar_t *) wString, size * sizeof(wchar_t), GetInternalFormat(), buffer, length + 1, encoding);
+	Int		 bufferSize = ConvertString(chars, bytes, GetInternalFormat(), NIL, 0, encoding);
+
+	if (bufferSize == -1) bufferSize = ConvertString(chars, bytes, GetInternalFormat(), NIL, 0, "ISO-8859-1");
+
+	/* Replace characters that cannot be converted.
+	 */
+	if (bufferSize <= 0)
+	{
+		if (size <= length) return length + 1;
+
+		ConvertString(chars, bytes, GetInternalFormat(), buffer, length + 1, encoding);
 
 		for (Int i = -bufferSize; i < length; i++) buffer[i] = '?';
 
 		buffer[length] = 0;
+
+		return length + 1;
 	}
-	else
+
+	/* Some converters need room for an extra byte.
+	 */
+	if (size <= bufferSize) return bufferSize + 1;
+
+	ConvertString(chars, bytes, GetInternalFormat(), buffer, size, encoding);
+
+	return bufferSize + 1;
+}
+
+S::Int S::String::ConvertTo(const char *encoding, Buffer<char> &buffer) const
+{
+	Int	 needed = ConvertTo(encoding, buffer, buffer.Size());
+
+	/* Grow buffer and try again if it was too small.
+	 */
+	if (needed > buffer.Size())
 	{
-		buffer = new char [bufferSize + 1];
+		buffer.Resize(needed);
 
-		ConvertString((char *) (wchar_t *) wString, size * sizeof(wchar_t), GetInternalFormat(), buffer, bufferSize + 1, encoding);
+		ConvertTo(encoding, buffer, needed);
 	}
 
-	AddTemporaryBuffer(buffer);
+	return needed;
+}
 
-	return buffer;
+S::String::ConvertedString::ConvertedString(const String &string, const char *encoding)
+{
+	if (string.Length() == 0) return;
+
+	if (encoding == NIL) encoding = GetOutputFormat();
+
+	/* Convert to inline memory first.
+	 */
+	buffer.Resize(256);
+
+	Int	 needed = string.ConvertTo(encoding, buffer, 256);
+
+	if (needed > 256)
+	{
+		buffer.Resize(needed);
+
+		string.ConvertTo(encoding, buffer, needed);
+	}
 }
 
 wchar_t &S::String::operator [](int n)
@@ -418,17 +647,26 @@ wchar_t &S::String::operator [](int n)
 		/* Allocate more memory than actually
 		 * needed to speed up string operations.
 		 */
-		wString.Resize(n + Math::Max(10, Math::Min(n / 10, 100000)));
+		Reserve(n + Math::Max(10, Math::Min(n / 10, 100000)));
 
 		wmemset(wString + length, 0, wString.Size() - length);
 	}
 
+	/* Characters may be changed via the returned reference, so note
+	 * the lowest index handed out for Length() to check it later.
+	 */
+	if (stringLength >= 0)
+	{
+		if (writeIndex == -1) writeIndex = n;
+		else		      writeIndex = -2 - Math::Min(writeIndex >= 0 ? writeIndex : -2 - writeIndex, n);
+	}
+
 	return wString[n];
 }
 
 wchar_t S::String::operator []( int n) const
 {
-	if (n < 0 || n + 1 >= wString.Size()) return 0;
+	if (n < 0 || n >= Length()) return 0;
 
 	return wString[n];
 }
@@ -440,6 +678,9 @@ S::String::operator char *() const
 
 S::String::operator wchar_t *() const
 {
+	/* Characters must not be changed via the returned
+	 * pointer. Use operator [] for writable access.
+	 */
 	return wString;
 }
 
@@ -470,6 +711,8 @@ S::String &S::String::operator =(const wchar_t *newString)
 		wString.Resize(size);
 
 		wcsncpy(wString, newString, size);
+
+		stringLength = size - 1;
 	}
 
 	return *this;
@@ -483,16 +726,34 @@ S::String &S::String::operator =(const String &newString)
 
 	if (newString.wString.Size() > 0)
 	{
-		Int	 size = newString.wString.Size();
+		Int	 size = newString.Length() + 1;
 
 		wString.Resize(size);
 
-		wcsncpy(wString, newString.wString, size);
+		wmemcpy(wString, newString.wString, size);
+
+		stringLength = size - 1;
 	}
 
 	return *this;
 }
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+S::String &S::String::operator =(String &&newString)
+{
+	if (&newString == this) return *this;
+
+	wString.Swap(newString.wString);
+
+	stringLength = newString.stringLength;
+	writeIndex   = newString.writeIndex;
+
+	newString.Clean();
+
+	return *this;
+}
+#endif
+
 S::Bool S::String::operator ==(const int nil) const
 {
 	if (wString.Size() == 0) return True;
@@ -575,9 +836,24 @@ S::Bool S::String::operator !=(const String &str) const
 
 S::Int S::String::Length() const
 {
-	if (wString.Size() == 0) return 0;
+	if (stringLength >= 0 && writeIndex == -1) return stringLength;
+	if (wString.Size() == 0)		   return 0;
+
+	/* Check characters that may have been changed via operator [].
+	 * Characters before the lowest index handed out are unchanged.
+	 * A single write inside the string either truncated it or left
+	 * its length unchanged, a write at its end may have extended it.
+	 */
+	Int	 index = writeIndex >= 0 ? writeIndex : -2 - writeIndex;
+
+	if	(stringLength < 0)		 stringLength = wcslen(wString);
+	else if (index >= stringLength)		 stringLength += wcslen(wString + stringLength);
+	else if (writeIndex < -1)		 stringLength = index + wcslen(wString + index);
+	else if (wString[index] == 0)		 stringLength = index;
 
-	return wcslen(wString);
+	writeIndex = -1;
+
+	return stringLength;
 }
 
 S::Int S::String::Find(const String &str) const
@@ -585,26 +861,19 @@ S::Int S::String::Find(const String &str) const
 	if (str	  == NIL) return 0;
 	if (*this == NIL) return -1;
 
-	wchar_t* start = wcsstr(wString, str.wString);
-
-	if (start != NIL) return start - wString;
+	return FindChars(wString, Length(), str.wString, str.Length());
+}
 
-	return -1;
+S::Int S::String::Find(const StringView &view) const
+{
+	return StringView(*this).Find(view);
 }
 
 S::Int S::String::FindLast(const String &str) const
 {
 	if (str == NIL) return Length();
 
-	Int	 len1 = Length();
-	Int	 len2 = str.Length();
-
-	for (Int i = len1 - len2; i >= 0; i--)
-	{
-		if (wcsncmp(wString + i, str.wString, len2) == 0) return i;
-	}
-
-	return -1;
+	return FindLastChars(wString, Length(), str.wString, str.Length());
 }
 
 S::String &S::String::Append(const String &str)
@@ -614,12 +883,14 @@ S::String &S::String::Append(const String &str)
 	Int	 len1 = Length();
 	Int	 len2 = str.Length();
 
-	wString.Resize(len1 + len2 + 1);
+	Reserve(len1 + len2 + 1);
 
-	wcsncpy(wString + len1, str.wString, len2);
+	wmemcpy(wString + len1, str.wString, len2);
 
 	wString[len1 + len2] = 0;
 
+	stringLength = len1 + len2;
+
 	return *this;
 }
 
@@ -632,32 +903,179 @@ S::String &S::String::Replace(const String &str1, const String &str2)
 {
 	if (str1 == NIL) return *this;
 
+	/* Work on copies if arguments refer to this string.
+	 */
+	if (&str1 == this || &str2 == this) return Replace(String(str1), String(str2));
+
 	Int	 len1 = Length();
 	Int	 len2 = str1.Length();
 	Int	 len3 = str2.Length();
 
-	for (Int i = 0; i <= len1 - len2; i++)
+	/* Count matches first to get the resulting length.
+	 */
+	Int	 matches = 0;
+
+	for (Int i = 0, n = 0; (n = FindChars(wString + i, len1 - i, str1.wString, len2)) >= 0; i += n + len2) matches++;
+
+	if (matches == 0) return *this;
+
+	Int	 length = len1 + matches * (len3 - len2);
+
+	if (len3 <= len2)
 	{
-		if (wcsncmp(wString + i, str1.wString, len2) == 0)
+		/* Replace in place if the string does not grow.
+		 */
+		Int	 in  = 0;
+		Int	 out = 0;
+
+		for (Int m = 0; m < matches; m++)
 		{
-			if (len2 != len3)
+			Int	 n = FindChars(wString + in, len1 - in, str1.wString, len2);
+
+			if (out != in) wmemmove(wString + out, wString + in, n);
+
+			out += n;
+			in  += n + len2;
+
+			if (len3 > 0) wmemcpy(wString + out, str2.wString, len3);
+
+			out += len3;
+		}
+
+		wmemmove(wString + out, wString + in, len1 - in + 1);
+	}
+	else
+	{
+		/* Build the result in a new buffer otherwise.
+		 */
+		SmallBuffer<wchar_t, 32 / sizeof(wchar_t)>	 result;
+
+		result.Resize(length + 1);
+
+		Int	 in  = 0;
+		Int	 out = 0;
+
+		for (Int m = 0; m < matches; m++)
+		{
+			Int	 n = FindChars(wString + in, len1 - in, str1.wString, len2);
+
+			wmemcpy(result + out, wString + in, n);
+			wmemcpy(result + out + n, str2.wString, len3);
+
+			out += n + len3;
+			in  += n + len2;
+		}
+
+		wmemcpy(result + out, wString + in, len1 - in + 1);
+
+		wString.Swap(result);
+	}
+
+	stringLength = length;
+
+	return *this;
+}
+
+S::String &S::String::Replace(const Array<String> &patterns, const Array<String> &replacements)
+{
+	Int	 len1  = Length();
+	Int	 count = Math::Min(patterns.Length(), replacements.Length());
+
+	if (len1 == 0 || count == 0) return *this;
+
+	/* Collect patterns and mark their first characters.
+	 */
+	Buffer<const String *>	 table(count * 2);
+	Bool			 first[256];
+
+	memset(first, 0, sizeof(first));
+
+	for (Int i = 0; i < count; i++)
+	{
+		table[i * 2]	 = &patterns.GetNth(i);
+		table[i * 2 + 1] = &replacements.GetNth(i);
+
+		if (table[i * 2]->Length() > 0) first[table[i * 2]->wString[0] & 0xFF] = True;
+	}
+
+	/* Measure the result, then build it in a single pass. At
+	 * each position the first matching pattern is replaced.
+	 */
+	const wchar_t					*chars	 = wString;
+	SmallBuffer<wchar_t, 32 / sizeof(wchar_t)>	 result;
+	wchar_t						*target	 = NIL;
+	Int						 length	 = 0;
+	Int						 matches = 0;
+
+	for (Int pass = 0; pass < 2; pass++)
+	{
+		Int	 out = 0;
+
+		for (Int i = 0; i < len1; )
+		{
+			const String	*match = NIL;
+
+			if (first[chars[i] & 0xFF])
+			{
+				for (Int j = 0; j < count; j++)
+				{
+					const String	*pattern = table[j * 2];
+					Int		 len2	 = pattern->Length();
+
+					if (len2 == 0 || len2 > len1 - i || wmemcmp(chars + i, pattern->wString, len2) != 0) continue;
+
+					match = table[j * 2 + 1];
+					i    += len2;
+
+					break;
+				}
+			}
+
+			if (match == NIL)
+			{
+				if (pass == 1) target[out] = chars[i];
+
+				out++;
+				i++;
+			}
+			else
 			{
-				if (len3 > len2) wString.Resize(len1 + 1 + (len3 - len2));
+				Int	 len3 = match->Length();
 
-				wmemmove(wString + i + len3, wString + i + len2, len1 - i - len2 + 1);
+				if (pass == 1 && len3 > 0) wmemcpy(target + out, match->wString, len3);
 
-				len1 += (len3 - len2);
+				out += len3;
+
+				matches++;
 			}
+		}
+
+		if (pass == 0)
+		{
+			if (matches == 0) return *this;
 
-			if (len3 > 0) wcsncpy(wString + i, str2.wString, len3);
+			length = out;
 
-			i += len3 - 1;
+			result.Resize(length + 1);
+
+			target = result;
 		}
 	}
 
+	target[length] = 0;
+
+	wString.Swap(result);
+
+	stringLength = length;
+
 	return *this;
 }
 
+S::String S::String::Replace(const Array<String> &patterns, const Array<String> &replacements) const
+{
+	return String(*this).Replace(patterns, replacements);
+}
+
 S::String S::String::Replace(const String &str1, const String &str2) const
 {
 	return String(*this).Replace(str1, str2);
@@ -681,17 +1099,56 @@ S::String &S::String::CopyN(const String &str, const Int n)
 		wcsncpy(wString, str.wString, n);
 
 		wString[n] = 0;
+
+		stringLength = Math::Min(n, str.Length());
 	}
 
 	return *this;
 }
 
+S::Int S::String::FindIgnoreCase(const String &str) const
+{
+	Int	 len1 = Length();
+	Int	 len2 = str.Length();
+
+	if (len2 == 0)	  return 0;
+	if (len1 < len2) return -1;
+
+	/* Fold the needle once, then compare
+	 * folded characters of the haystack.
+	 */
+	SmallBuffer<wchar_t, 32>	 needle;
+
+	needle.Resize(len2);
+
+	for (Int i = 0; i < len2; i++) needle[i] = FoldCase(str.wString[i]);
+
+	for (Int i = 0; i <= len1 - len2; i++)
+	{
+		if (FoldCase(wString[i]) != needle[0]) continue;
+
+		Int	 n = 1;
+
+		while (n < len2 && FoldCase(wString[i + n]) == needle[n]) n++;
+
+		if (n == len2) return i;
+	}
+
+	return -1;
+}
+
 S::Bool S::String::Contains(const String &str) const
 {
 	if (Find(str) >= 0) return True;
 	else		    return False;
 }
 
+S::Bool S::String::ContainsIgnoreCase(const String &str) const
+{
+	if (FindIgnoreCase(str) >= 0) return True;
+	else			      return False;
+}
+
 S::Int S::String::Compare(const String &str) const
 {
 	Int	 len1 = Length();
@@ -703,6 +1160,26 @@ S::Int S::String::Compare(const String &str) const
 	return 0;
 }
 
+S::Int S::String::Compare(const StringView &view) const
+{
+	return StringView(*this).Compare(view);
+}
+
+S::Int S::String::CompareIgnoreCase(const String &str) const
+{
+	Int	 len1 = Length();
+	Int	 len2 = str.Length();
+
+	if (len1 != len2) return len1 - len2;
+
+	for (Int i = 0; i < len1; i++)
+	{
+		if (wString[i] != str.wString[i] && FoldCase(wString[i]) != FoldCase(str.wString[i])) return 1;
+	}
+
+	return 0;
+}
+
 S::Int S::String::CompareN(const String &str, Int n) const
 {
 	if (n == 0)	  return 0;
@@ -730,6 +1207,11 @@ S::Bool S::String::StartsWith(const String &str) const
 	return False;
 }
 
+S::Bool S::String::StartsWith(const StringView &view) const
+{
+	return StringView(*this).StartsWith(view);
+}
+
 S::Bool S::String::EndsWith(const String &str) const
 {
 	if (str == NIL) return True;
@@ -759,6 +1241,8 @@ S::String S::String::SubString(Int start, Int number) const
 
 	subString.wString[number] = 0;
 
+	subString.stringLength = Math::Min(number, Length() - start);
+
 	return subString;
 }
 
@@ -809,6 +1293,8 @@ S::String &S::String::Fill(const Int value)
 
 	wmemset(wString, value, Length());
 
+	if (value == 0) stringLength = 0;
+
 	return *this;
 }
 
@@ -823,6 +1309,8 @@ S::String &S::String::FillN(const Int value, const Int count)
 		wmemset(wString, value, count);
 
 		wString[count] = 0;
+
+		stringLength = value == 0 ? 0 : count;
 	}
 
 	return *this;
@@ -830,22 +1318,26 @@ S::String &S::String::FillN(const Int value, const Int count)
 
 S::Int64 S::String::ToInt() const
 {
-	return Number::FromIntString(*this);
+	return StringView(*this).ToInt();
 }
 
 S::Float S::String::ToFloat() const
 {
-	return Number::FromFloatString(*this);
+	return StringView(*this).ToFloat();
 }
 
 S::String S::String::FromInt(const Int64 value)
 {
-	return Number(value).ToIntString();
+	StringBuilder	 builder;
+
+	return builder.Append(value).Finish();
 }
 
 S::String S::String::FromFloat(Float value)
 {
-	return Number(value).ToFloatString();
+	StringBuilder	 builder;
+
+	return builder.Append(value).Finish();
 }
 
 S::Array<S::String> S::String::Explode(const String &delimiter) const
@@ -853,36 +1345,32 @@ S::Array<S::String> S::String::Explode(const String &delimiter) const
 	/* Split string and add entries to array.
 	 */
 	Array<String>	 array;
-	Int		 length	= Length();
-
-	for (Int i = 0; i < length; )
-	{
-		Int	 index = SubString(i, length - i).Find(delimiter);
-		String	 part;
+	StringTokenizer	 tokenizer(*this, delimiter);
+	StringView	 token;
 
-		if (index == -1) part = SubString(i, length - i);
-		else		 part = SubString(i, index);
-
-		array.Add(part);
-
-		i += part.Length() + delimiter.Length();
-	}
+	while (tokenizer.Next(token)) array.Add(token.ToString());
 
 	return array;
 }
 
 S::String S::String::Implode(const Array<String> &array, const String &delimiter)
 {
-	String	 string;
+	/* Compute length first to build the string in a single allocation.
+	 */
+	Int	 length = delimiter.Length() * Math::Max(0, array.Length() - 1);
+
+	for (Int i = 0; i < array.Length(); i++) length += array.GetNth(i).Length();
+
+	StringBuilder	 builder(length);
 
 	for (Int i = 0; i < array.Length(); i++)
 	{
-		if (i > 0) string.Append(delimiter);
+		if (i > 0) builder.Append(delimiter);
 
-		string.Append(array.GetNth(i));
+		builder.Append(array.GetNth(i));
 	}
 
-	return string;
+	return builder.Finish();
 }
 
 S::Int S::ConvertString(const char *inBuffer, Int inBytes, const char *inEncoding, char *outBuffer, Int outBytes, const char *outEncoding)
@@ -914,22 +1402,24 @@ S::Int S::ConvertString(const char *inBuffer, Int inBytes, const char *inEncodin
 		return inBytes;
 	}
 
+	/* Use built-in converters for common Unicode encodings.
+	 */
+	Int	 nativeIn  = GetNativeEncoding(inEncoding);
+	Int	 nativeOut = GetNativeEncoding(outEncoding);
+
+	if (nativeIn != NATIVE_NONE && nativeOut != NATIVE_NONE) return ConvertNative(inBuffer, inBytes, nativeIn, outBuffer, outBytes, nativeOut);
+
 	/* Convert using iconv/libiconv.
 	 */
 	if (Setup::useIconv)
 	{
-		/* Open and configure iconv.
+		/* Get a cached or newly opened conversion descriptor.
 		 */
-		iconv_t	 cd = iconv_open(outEncoding, inEncoding);
+		Bool	 cached = False;
+		iconv_t	 cd	= OpenIconv(inEncoding, outEncoding, cached);
 
 		if (cd != (iconv_t) -1)
 		{
-#if _LIBICONV_VERSION >= 0x0108
-			int	 on = 1;
-
-			iconvctl(cd, ICONV_SET_TRANSLITERATE, &on);
-#endif
-
 			/* Assign output buffer if not provided.
 			 */
 			Buffer<char>	*outBufferObject = NIL;
@@ -975,7 +1465,7 @@ S::Int S::ConvertString(const char *inBuffer, Int inBytes, const char *inEncodin
 				if (iconv(cd, inPointer, &inBytesLeft, outPointer, &outBytesLeft) == (size_t) -1) break;
 			}
 
-			iconv_close(cd);
+			if (!cached) iconv_close(cd);
 
 			if (outBufferObject) delete outBufferObject;
 
@@ -1081,3 +1571,406 @@ S::Int S::ConvertString(const char *inBuffer, Int inBytes, const char *inEncodin
 
 	return -1;
 }
+
+S::Bool S::IsASCIICompatible(const char *encoding)
+{
+	/* Encodings mapping bytes 0x00 to 0x7F to the
+	 * corresponding ASCII characters.
+	 */
+	static const char	*names[]    = { "UTF-8", "UTF8", "ASCII", "US-ASCII", "ANSI_X3.4-1968", NIL };
+	static const char	*prefixes[] = { "ISO-8859-", "ISO8859-", "ISO_8859-", "LATIN", "CP125", "WINDOWS-125", "KOI8-", NIL };
+
+	for (Int n = 0; n < 2; n++)
+	{
+		const char	**list = (n == 0 ? names : prefixes);
+
+		for (Int i = 0; list[i] != NIL; i++)
+		{
+			const char	*name = list[i];
+			Int		 j    = 0;
+
+			while (name[j] != 0 && encoding[j] != 0 && (encoding[j] & ~0x20) == (name[j] & ~0x20)) j++;
+
+			if (name[j] == 0 && (n == 1 || encoding[j] == 0)) return True;
+		}
+	}
+
+	return False;
+}
+
+S::Int S::FindChars(const wchar_t *haystack, Int length, const wchar_t *needle, Int count)
+{
+	if (count > length) return -1;
+	if (count == 0)	    return 0;
+
+	/* Filter candidates by their first character for short
+	 * needles or haystacks, letting wmemchr do the scanning.
+	 */
+	if (count < 4 || length < 256)
+	{
+		const wchar_t	*position = haystack;
+		const wchar_t	*last	  = haystack + length - count;
+
+		while (position <= last)
+		{
+			position = (const wchar_t *) wmemchr(position, needle[0], last - position + 1);
+
+			if (position == NIL) return -1;
+
+			if (wmemcmp(position + 1, needle + 1, count - 1) == 0) return position - haystack;
+
+			position++;
+		}
+
+		return -1;
+	}
+
+	/* Use Boyer-Moore-Horspool otherwise with a shift table
+	 * indexed by the low byte of each character.
+	 */
+	Int	 shift[256];
+
+	for (Int i = 0; i < 256;       i++) shift[i]		   = count;
+	for (Int i = 0; i < count - 1; i++) shift[needle[i] & 0xFF] = count - 1 - i;
+
+	wchar_t	 lastChar = needle[count - 1];
+
+	for (Int i = 0; i <= length - count; i += shift[haystack[i + count - 1] & 0xFF])
+	{
+		if (haystack[i + count - 1] == lastChar && wmemcmp(haystack + i, needle, count - 1) == 0) return i;
+	}
+
+	return -1;
+}
+
+S::Int S::FindLastChars(const wchar_t *haystack, Int length, const wchar_t *needle, Int count)
+{
+	if (count > length) return -1;
+	if (count == 0)	    return length;
+
+	if (count < 4 || length < 256)
+	{
+		for (Int i = length - count; i >= 0; i--)
+		{
+			if (haystack[i] == needle[0] && wmemcmp(haystack + i + 1, needle + 1, count - 1) == 0) return i;
+		}
+
+		return -1;
+	}
+
+	/* Mirrored Boyer-Moore-Horspool aligning on the first character.
+	 */
+	Int	 shift[256];
+
+	for (Int i = 0; i < 256; i++) shift[i] = count;
+
+	for (Int i = count - 1; i > 0; i--) shift[needle[i] & 0xFF] = i;
+
+	for (Int i = length - count; i >= 0; i -= shift[haystack[i] & 0xFF])
+	{
+		if (haystack[i] == needle[0] && wmemcmp(haystack + i + 1, needle + 1, count - 1) == 0) return i;
+	}
+
+	return -1;
+}
+
+iconv_t S::OpenIconv(const char *inEncoding, const char *outEncoding, Bool &cached)
+{
+	Bool	 cacheable = (strlen(inEncoding) < 32 && strlen(outEncoding) < 32);
+
+#if defined(__APPLE__) || defined(__OpenBSD__)
+	/* Thread local storage is not available before initialization.
+	 */
+	if (!initialized) cacheable = False;
+#endif
+
+	/* Look for a cached descriptor and reset its state.
+	 */
+	if (cacheable && iconvCache != NIL)
+	{
+		for (Int i = 0; i < iconvCache->nOfDescriptors; i++)
+		{
+			if (strcmp(iconvCache->inEncodings[i], inEncoding) != 0 || strcmp(iconvCache->outEncodings[i], outEncoding) != 0) continue;
+
+			iconv(iconvCache->descriptors[i], NIL, NIL, NIL, NIL);
+
+			cached = True;
+
+			return iconvCache->descriptors[i];
+		}
+	}
+
+	/* Open and configure iconv.
+	 */
+	iconv_t	 cd = iconv_open(outEncoding, inEncoding);
+
+	if (cd == (iconv_t) -1) return cd;
+
+#if _LIBICONV_VERSION >= 0x0108
+	int	 on = 1;
+
+	iconvctl(cd, ICONV_SET_TRANSLITERATE, &on);
+#endif
+
+	if (!cacheable) return cd;
+
+	/* Add to cache, replacing the oldest entry if full.
+	 */
+	if (iconvCache == NIL) iconvCache = new IconvCache();
+
+	Int	 slot = iconvCache->next;
+
+	if (slot < iconvCache->nOfDescriptors) iconv_close(iconvCache->descriptors[slot]);
+	else				       iconvCache->nOfDescriptors++;
+
+	strcpy(iconvCache->inEncodings[slot], inEncoding);
+	strcpy(iconvCache->outEncodings[slot], outEncoding);
+
+	iconvCache->descriptors[slot] = cd;
+	iconvCache->next	      = (slot + 1) % IconvCache::Size;
+
+	cached = True;
+
+	return cd;
+}
+
+namespace smooth
+{
+	static inline Bool IsEncoding(const char *encoding, const char *name)
+	{
+		Int	 i = 0;
+
+		while (name[i] != 0 && (encoding[i] & ~0x20) == (name[i] & ~0x20)) i++;
+
+		return name[i] == 0 && encoding[i] == 0;
+	}
+
+	/* Decode a single character, returning -1 for invalid or incomplete input.
+	 */
+	static inline Int DecodeNative(Int encoding, const UnsignedByte *&in, const UnsignedByte *end)
+	{
+		UnsignedInt32	 c = 0;
+
+		switch (encoding)
+		{
+			case NATIVE_UTF8:
+				{
+					c = *in;
+
+					if (c < 0x80) { in++; return c; }
+
+					Int		 n   = (c >= 0xF0) ? 3 : (c >= 0xE0) ? 2 : (c >= 0xC0) ? 1 : 0;
+					UnsignedInt32	 min = (n == 3) ? 0x10000 : (n == 2) ? 0x800 : 0x80;
+
+					if (n == 0 || c >= 0xF8 || end - in <= n) return -1;
+
+					c &= 0x3F >> n;
+
+					for (Int i = 1; i <= n; i++)
+					{
+						if ((in[i] & 0xC0) != 0x80) return -1;
+
+						c = (c << 6) | (in[i] & 0x3F);
+					}
+
+					if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) return -1;
+
+					in += n + 1;
+
+					return c;
+				}
+			case NATIVE_LATIN1:
+				return *in++;
+			case NATIVE_UTF16LE:
+			case NATIVE_UTF16BE:
+				{
+					if (end - in < 2) return -1;
+
+					Bool	 le = (encoding == NATIVE_UTF16LE);
+
+					c = le ? (in[0] | (in[1] << 8)) : ((in[0] << 8) | in[1]);
+
+					if (c >= 0xDC00 && c <= 0xDFFF) return -1;
+
+					if (c >= 0xD800 && c <= 0xDBFF)
+					{
+						if (end - in < 4) return -1;
+
+						UnsignedInt32	 c2 = le ? (in[2] | (in[3] << 8)) : ((in[2] << 8) | in[3]);
+
+						if (c2 < 0xDC00 || c2 > 0xDFFF) return -1;
+
+						c = 0x10000 + ((c - 0xD800) << 10) + (c2 - 0xDC00);
+
+						in += 2;
+					}
+
+					in += 2;
+
+					return c;
+				}
+			case NATIVE_UTF32LE:
+			case NATIVE_UTF32BE:
+				{
+					if (end - in < 4) return -1;
+
+					if (encoding == NATIVE_UTF32LE) c = in[0] | (in[1] << 8) | (in[2] << 16) | ((UnsignedInt32) in[3] << 24);
+					else				c = ((UnsignedInt32) in[0] << 24) | (in[1] << 16) | (in[2] << 8) | in[3];
+
+					if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) return -1;
+
+					in += 4;
+
+					return c;
+				}
+		}
+
+		return -1;
+	}
+
+	/* Encode a single character, returning the number of bytes
+	 * or -1 if it cannot be represented in the target encoding.
+	 */
+	static inline Int EncodeNative(Int encoding, UnsignedInt32 c, UnsignedByte *out)
+	{
+		switch (encoding)
+		{
+			case NATIVE_UTF8:
+				if (c < 0x80)	 {						    out[0] = c;							     return 1; }
+				if (c < 0x800)	 { out[0] = 0xC0 | (c >>  6);				    out[1] = 0x80 | (c & 0x3F);				     return 2; }
+				if (c < 0x10000) { out[0] = 0xE0 | (c >> 12); out[1] = 0x80 | ((c >>  6) & 0x3F);	    out[2] = 0x80 | (c & 0x3F);		     return 3; }
+				else		 { out[0] = 0xF0 | (c >> 18); out[1] = 0x80 | ((c >> 12) & 0x3F); out[2] = 0x80 | ((c >> 6) & 0x3F); out[3] = 0x80 | (c & 0x3F); return 4; }
+			case NATIVE_LATIN1:
+				if (c > 0xFF) return -1;
+
+				out[0] = c;
+
+				return 1;
+			case NATIVE_UTF16LE:
+			case NATIVE_UTF16BE:
+				{
+					Int	 le = (encoding == NATIVE_UTF16LE);
+
+					if (c < 0x10000) { out[le ? 0 : 1] = c & 0xFF; out[le ? 1 : 0] = c >> 8; return 2; }
+
+					UnsignedInt32	 c1 = 0xD800 + ((c - 0x10000) >> 10);
+					UnsignedInt32	 c2 = 0xDC00 + ((c - 0x10000) & 0x3FF);
+
+					out[le ? 0 : 1] = c1 & 0xFF; out[le ? 1 : 0] = c1 >> 8;
+					out[le ? 2 : 3] = c2 & 0xFF; out[le ? 3 : 2] = c2 >> 8;
+
+					return 4;
+				}
+			case NATIVE_UTF32LE:
+				out[0] = c; out[1] = c >> 8; out[2] = c >> 16; out[3] = c >> 24;
+
+				return 4;
+			case NATIVE_UTF32BE:
+				out[3] = c; out[2] = c >> 8; out[1] = c >> 16; out[0] = c >> 24;
+
+				return 4;
+		}
+
+		return -1;
+	}
+};
+
+S::Int S::GetNativeEncoding(const char *encoding)
+{
+	if	(IsEncoding(encoding, "UTF-8")	    || IsEncoding(encoding, "UTF8"))	   return NATIVE_UTF8;
+	else if (IsEncoding(encoding, "ISO-8859-1") || IsEncoding(encoding, "LATIN1"))	   return NATIVE_LATIN1;
+	else if (IsEncoding(encoding, "UTF-16LE"))					   return NATIVE_UTF16LE;
+	else if (IsEncoding(encoding, "UTF-16BE"))					   return NATIVE_UTF16BE;
+	else if (IsEncoding(encoding, "UTF-32LE"))					   return NATIVE_UTF32LE;
+	else if (IsEncoding(encoding, "UTF-32BE"))					   return NATIVE_UTF32BE;
+
+	return NATIVE_NONE;
+}
+
+S::Int S::ConvertNative(const char *inBuffer, Int inBytes, Int inEncoding, char *outBuffer, Int outBytes, Int outEncoding)
+{
+	/* Convert in a single pass, just measuring the
+	 * output size if no output buffer is provided.
+	 */
+	const UnsignedByte	*in	= (const UnsignedByte *) inBuffer;
+	const UnsignedByte	*end	= in + inBytes;
+	UnsignedByte		*out	= (UnsignedByte *) outBuffer;
+	UnsignedByte		 scratch[4];
+	Int			 size	= 0;
+
+	/* Handle runs of ASCII characters between UTF-8 and
+	 * the internal format with the vectorized kernels.
+	 */
+	static Int		 internal = GetNativeEncoding(String::GetInternalFormat());
+
+	Bool			 widen	  = (inEncoding == NATIVE_UTF8 && outEncoding == internal && out != NIL && ((UnsignedInt64) out & (sizeof(wchar_t) - 1)) == 0);
+	Bool			 narrow	  = (inEncoding == internal && (outEncoding == NATIVE_UTF8 || outEncoding == NATIVE_LATIN1) && ((UnsignedInt64) in & (sizeof(wchar_t) - 1)) == 0);
+
+	while (in < end)
+	{
+		if (widen && *in < 0x80)
+		{
+			Int	 count = Math::Min(end - in, (outBytes - size) / sizeof(wchar_t));
+			Int	 done  = WidenASCII((const char *) in, (wchar_t *) (out + size), count);
+
+			in   += done;
+			size += done * sizeof(wchar_t);
+
+			if (done > 0) continue;
+		}
+		else if (narrow && end - in >= Int(sizeof(wchar_t)) && (UnsignedInt32) *(const wchar_t *) in < 0x80)
+		{
+			Int	 count = (end - in) / sizeof(wchar_t);
+			Int	 done  = 0;
+
+			if (out != NIL)
+			{
+				done = NarrowASCII((const wchar_t *) in, (char *) out + size, Math::Min(count, outBytes - size));
+			}
+			else
+			{
+				/* Just measure using a scratch buffer.
+				 */
+				char	 measure[256];
+
+				while (done < count)
+				{
+					Int	 block = Math::Min(count - done, Int(sizeof(measure)));
+					Int	 n     = NarrowASCII((const wchar_t *) in + done, measure, block);
+
+					done += n;
+
+					if (n < block) break;
+				}
+			}
+
+			in   += done * sizeof(wchar_t);
+			size += done;
+
+			if (done > 0) continue;
+		}
+
+		Int	 c = DecodeNative(inEncoding, in, end);
+
+		if (c < 0) return -size;
+
+		/* Encode directly to the output buffer
+		 * unless we are close to its end.
+		 */
+		UnsignedByte	*target = (out != NIL && size + 4 <= outBytes) ? out + size : scratch;
+		Int		 n	= EncodeNative(outEncoding, c, target);
+
+		if (n < 0) return -size;
+
+		if (out != NIL && target == scratch)
+		{
+			if (size + n > outBytes) return -size;
+
+			memcpy(out + size, scratch, n);
+		}
+
+		size += n;
+	}
+
+	return size;
+}
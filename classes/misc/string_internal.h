@@ -0,0 +1,54 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_STRING_INTERNAL
+#define H_OBJSMOOTH_STRING_INTERNAL
+
+#include <smooth/definitions.h>
+
+/* Helpers shared by the string classes, not part of the public API.
+ */
+namespace smooth
+{
+	/* Encoding helpers and character search, see string.cpp.
+	 */
+	Bool			 IsASCIICompatible(const char *);
+
+	Int			 FindChars(const wchar_t *, Int, const wchar_t *, Int);
+	Int			 FindLastChars(const wchar_t *, Int, const wchar_t *, Int);
+
+	/* Vectorized kernels selected at runtime, see string_simd.cpp.
+	 */
+	typedef Int (*WidenASCIIKernel)(const char *, wchar_t *, Int);
+	typedef Int (*NarrowASCIIKernel)(const wchar_t *, char *, Int);
+	typedef Int (*ScanANSIKernel)(const wchar_t *, Int);
+	typedef Int (*CaseASCIIKernel)(const wchar_t *, wchar_t *, Int, wchar_t);
+
+	extern WidenASCIIKernel	 WidenASCII;
+	extern NarrowASCIIKernel NarrowASCII;
+	extern ScanANSIKernel	 ScanANSI;
+	extern CaseASCIIKernel	 CaseASCII;
+
+	Void			 SelectStringKernels();
+
+	/* Case mapping from the generated string_case.cpp.
+	 */
+	enum CaseMapping
+	{
+		CASE_UPPER = 0,
+		CASE_LOWER,
+		CASE_TITLE,
+		CASE_FOLD
+	};
+
+	wchar_t			 MapCase(wchar_t, Int);
+};
+
+#endif
@@ -0,0 +1,589 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/definitions.h>
+#include <smooth/system/cpu.h>
+
+#include "simd.h"
+#include "string_internal.h"
+
+/* String kernels working on runs of characters.
+ *
+ * WidenASCII and NarrowASCII convert characters up to the first
+ * non-ASCII one and return the number of characters converted.
+ * ScanANSI returns the index of the first character that is not
+ * printable ISO-8859-1 or count if there is no such character.
+ * CaseASCII toggles the case of letters from first to first + 25
+ * while copying ASCII characters and returns the number copied.
+ */
+namespace smooth
+{
+	static inline Bool IsANSIChar(wchar_t c)
+	{
+		return !(c < 0x20 || c > 0xFF || (c >= 0x80 && c < 0xA0));
+	}
+
+	/* Portable kernels.
+	 */
+	static Int WidenASCIIScalar(const char *in, wchar_t *out, Int count)
+	{
+		Int	 i = 0;
+
+		while (i < count && (UnsignedByte) in[i] < 0x80) { out[i] = in[i]; i++; }
+
+		return i;
+	}
+
+	static Int NarrowASCIIScalar(const wchar_t *in, char *out, Int count)
+	{
+		Int	 i = 0;
+
+		while (i < count && (UnsignedInt32) in[i] < 0x80) { out[i] = in[i]; i++; }
+
+		return i;
+	}
+
+	static Int ScanANSIScalar(const wchar_t *in, Int count)
+	{
+		Int	 i = 0;
+
+		while (i < count && IsANSIChar(in[i])) i++;
+
+		return i;
+	}
+
+	static Int CaseASCIIScalar(const wchar_t *in, wchar_t *out, Int count, wchar_t first)
+	{
+		Int	 i = 0;
+
+		for (; i < count && (UnsignedInt32) in[i] < 0x80; i++) out[i] = in[i] ^ ((UnsignedInt32) (in[i] - first) < 26 ? 0x20 : 0);
+
+		return i;
+	}
+
+#ifdef SMOOTH_SIMD_X86
+	/* SSE2 kernels processing 16 characters per iteration.
+	 */
+	SMOOTH_TARGET("sse2") static Int WidenASCIISSE2(const char *in, wchar_t *out, Int count)
+	{
+		const __m128i	 zero = _mm_setzero_si128();
+		Int		 i    = 0;
+
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i	 v = _mm_loadu_si128((const __m128i *) (in + i));
+
+			if (_mm_movemask_epi8(v) != 0) break;
+
+			__m128i	 lo = _mm_unpacklo_epi8(v, zero);
+			__m128i	 hi = _mm_unpackhi_epi8(v, zero);
+
+			if (sizeof(wchar_t) == 2)
+			{
+				_mm_storeu_si128((__m128i *) (out + i    ), lo);
+				_mm_storeu_si128((__m128i *) (out + i + 8), hi);
+			}
+			else
+			{
+				_mm_storeu_si128((__m128i *) (out + i     ), _mm_unpacklo_epi16(lo, zero));
+				_mm_storeu_si128((__m128i *) (out + i +  4), _mm_unpackhi_epi16(lo, zero));
+				_mm_storeu_si128((__m128i *) (out + i +  8), _mm_unpacklo_epi16(hi, zero));
+				_mm_storeu_si128((__m128i *) (out + i + 12), _mm_unpackhi_epi16(hi, zero));
+			}
+		}
+
+		return i + WidenASCIIScalar(in + i, out + i, count - i);
+	}
+
+	SMOOTH_TARGET("sse2") static Int NarrowASCIISSE2(const wchar_t *in, char *out, Int count)
+	{
+		const __m128i	 zero = _mm_setzero_si128();
+		Int		 i    = 0;
+
+		if (sizeof(wchar_t) == 2)
+		{
+			const __m128i	 mask = _mm_set1_epi16(~0x7F);
+
+			for (; i + 16 <= count; i += 16)
+			{
+				__m128i	 a = _mm_loadu_si128((const __m128i *) (in + i    ));
+				__m128i	 b = _mm_loadu_si128((const __m128i *) (in + i + 8));
+
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), mask), zero)) != 0xFFFF) break;
+
+				_mm_storeu_si128((__m128i *) (out + i), _mm_packus_epi16(a, b));
+			}
+		}
+		else
+		{
+			const __m128i	 mask = _mm_set1_epi32(~0x7F);
+
+			for (; i + 16 <= count; i += 16)
+			{
+				__m128i	 a = _mm_loadu_si128((const __m128i *) (in + i     ));
+				__m128i	 b = _mm_loadu_si128((const __m128i *) (in + i +  4));
+				__m128i	 c = _mm_loadu_si128((const __m128i *) (in + i +  8));
+				__m128i	 d = _mm_loadu_si128((const __m128i *) (in + i + 12));
+
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), mask), zero)) != 0xFFFF) break;
+
+				_mm_storeu_si128((__m128i *) (out + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+			}
+		}
+
+		return i + NarrowASCIIScalar(in + i, out + i, count - i);
+	}
+
+	SMOOTH_TARGET("sse2") static Int ScanANSISSE2(const wchar_t *in, Int count)
+	{
+		Int	 i = 0;
+
+		/* Signed compares treat characters above 0x7FFF as negative
+		 * with 16 bit wchar_t, which still classifies them correctly.
+		 */
+		if (sizeof(wchar_t) == 2)
+		{
+			const __m128i	 c20 = _mm_set1_epi16(0x20), c7F = _mm_set1_epi16(0x7F);
+			const __m128i	 cA0 = _mm_set1_epi16(0xA0), cFF = _mm_set1_epi16(0xFF);
+
+			for (; i + 16 <= count; i += 16)
+			{
+				__m128i	 bad = _mm_setzero_si128();
+
+				for (Int j = 0; j < 16; j += 8)
+				{
+					__m128i	 v = _mm_loadu_si128((const __m128i *) (in + i + j));
+
+					bad = _mm_or_si128(bad, _mm_or_si128(_mm_or_si128(_mm_cmplt_epi16(v, c20), _mm_cmpgt_epi16(v, cFF)),
+									     _mm_and_si128(_mm_cmpgt_epi16(v, c7F), _mm_cmplt_epi16(v, cA0))));
+				}
+
+				if (_mm_movemask_epi8(bad) != 0) break;
+			}
+		}
+		else
+		{
+			const __m128i	 c20 = _mm_set1_epi32(0x20), c7F = _mm_set1_epi32(0x7F);
+			const __m128i	 cA0 = _mm_set1_epi32(0xA0), cFF = _mm_set1_epi32(0xFF);
+
+			for (; i + 16 <= count; i += 16)
+			{
+				__m128i	 bad = _mm_setzero_si128();
+
+				for (Int j = 0; j < 16; j += 4)
+				{
+					__m128i	 v = _mm_loadu_si128((const __m128i *) (in + i + j));
+
+					bad = _mm_or_si128(bad, _mm_or_si128(_mm_or_si128(_mm_cmplt_epi32(v, c20), _mm_cmpgt_epi32(v, cFF)),
+									     _mm_and_si128(_mm_cmpgt_epi32(v, c7F), _mm_cmplt_epi32(v, cA0))));
+				}
+
+				if (_mm_movemask_epi8(bad) != 0) break;
+			}
+		}
+
+		return i + ScanANSIScalar(in + i, count - i);
+	}
+
+	SMOOTH_TARGET("sse2") static Int CaseASCIISSE2(const wchar_t *in, wchar_t *out, Int count, wchar_t first)
+	{
+		Int	 i = 0;
+
+		/* Compares are signed, but only run on ASCII characters.
+		 */
+		if (sizeof(wchar_t) == 2)
+		{
+			const __m128i	 mask  = _mm_set1_epi16(~0x7F), c20   = _mm_set1_epi16(0x20);
+			const __m128i	 lower = _mm_set1_epi16(first - 1), upper = _mm_set1_epi16(first + 26);
+
+			for (; i + 16 <= count; i += 16)
+			{
+				__m128i	 a = _mm_loadu_si128((const __m128i *) (in + i    ));
+				__m128i	 b = _mm_loadu_si128((const __m128i *) (in + i + 8));
+
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), mask), _mm_setzero_si128())) != 0xFFFF) break;
+
+				_mm_storeu_si128((__m128i *) (out + i    ), _mm_xor_si128(a, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi16(a, lower), _mm_cmplt_epi16(a, upper)), c20)));
+				_mm_storeu_si128((__m128i *) (out + i + 8), _mm_xor_si128(b, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi16(b, lower), _mm_cmplt_epi16(b, upper)), c20)));
+			}
+		}
+		else
+		{
+			const __m128i	 mask  = _mm_set1_epi32(~0x7F), c20   = _mm_set1_epi32(0x20);
+			const __m128i	 lower = _mm_set1_epi32(first - 1), upper = _mm_set1_epi32(first + 26);
+
+			for (; i + 16 <= count; i += 16)
+			{
+				__m128i	 v[4];
+
+				for (Int j = 0; j < 4; j++) v[j] = _mm_loadu_si128((const __m128i *) (in + i + 4 * j));
+
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(_mm_or_si128(v[0], v[1]), _mm_or_si128(v[2], v[3])), mask), _mm_setzero_si128())) != 0xFFFF) break;
+
+				for (Int j = 0; j < 4; j++) _mm_storeu_si128((__m128i *) (out + i + 4 * j), _mm_xor_si128(v[j], _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(v[j], lower), _mm_cmplt_epi32(v[j], upper)), c20)));
+			}
+		}
+
+		return i + CaseASCIIScalar(in + i, out + i, count - i, first);
+	}
+
+	/* AVX2 kernels processing 32 characters per iteration.
+	 */
+	SMOOTH_TARGET("avx2") static Int WidenASCIIAVX2(const char *in, wchar_t *out, Int count)
+	{
+		Int	 i = 0;
+
+		for (; i + 32 <= count; i += 32)
+		{
+			__m256i	 v = _mm256_loadu_si256((const __m256i *) (in + i));
+
+			if (_mm256_movemask_epi8(v) != 0) break;
+
+			if (sizeof(wchar_t) == 2)
+			{
+				_mm256_storeu_si256((__m256i *) (out + i     ), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+				_mm256_storeu_si256((__m256i *) (out + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+			}
+			else
+			{
+				for (Int j = 0; j < 32; j += 8) _mm256_storeu_si256((__m256i *) (out + i + j), _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) (in + i + j))));
+			}
+		}
+
+		return i + WidenASCIISSE2(in + i, out + i, count - i);
+	}
+
+	SMOOTH_TARGET("avx2") static Int NarrowASCIIAVX2(const wchar_t *in, char *out, Int count)
+	{
+		Int	 i = 0;
+
+		if (sizeof(wchar_t) == 2)
+		{
+			const __m256i	 mask = _mm256_set1_epi16(~0x7F);
+
+			for (; i + 32 <= count; i += 32)
+			{
+				__m256i	 a = _mm256_loadu_si256((const __m256i *) (in + i     ));
+				__m256i	 b = _mm256_loadu_si256((const __m256i *) (in + i + 16));
+
+				if (!_mm256_testz_si256(_mm256_or_si256(a, b), mask)) break;
+
+				/* Packing works per 128 bit lane, so restore the order of 64 bit blocks.
+				 */
+				_mm256_storeu_si256((__m256i *) (out + i), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+			}
+		}
+		else
+		{
+			const __m256i	 mask  = _mm256_set1_epi32(~0x7F);
+			const __m256i	 order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+			for (; i + 32 <= count; i += 32)
+			{
+				__m256i	 a = _mm256_loadu_si256((const __m256i *) (in + i     ));
+				__m256i	 b = _mm256_loadu_si256((const __m256i *) (in + i +  8));
+				__m256i	 c = _mm256_loadu_si256((const __m256i *) (in + i + 16));
+				__m256i	 d = _mm256_loadu_si256((const __m256i *) (in + i + 24));
+
+				if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), mask)) break;
+
+				/* Packing works per 128 bit lane, so restore the order of 32 bit blocks.
+				 */
+				_mm256_storeu_si256((__m256i *) (out + i), _mm256_permutevar8x32_epi32(_mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d)), order));
+			}
+		}
+
+		return i + NarrowASCIISSE2(in + i, out + i, count - i);
+	}
+
+	SMOOTH_TARGET("avx2") static Int ScanANSIAVX2(const wchar_t *in, Int count)
+	{
+		Int	 i = 0;
+
+		if (sizeof(wchar_t) == 2)
+		{
+			const __m256i	 c20 = _mm256_set1_epi16(0x20), c7F = _mm256_set1_epi16(0x7F);
+			const __m256i	 cA0 = _mm256_set1_epi16(0xA0), cFF = _mm256_set1_epi16(0xFF);
+
+			for (; i + 32 <= count; i += 32)
+			{
+				__m256i	 bad = _mm256_setzero_si256();
+
+				for (Int j = 0; j < 32; j += 16)
+				{
+					__m256i	 v = _mm256_loadu_si256((const __m256i *) (in + i + j));
+
+					bad = _mm256_or_si256(bad, _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi16(c20, v), _mm256_cmpgt_epi16(v, cFF)),
+										   _mm256_and_si256(_mm256_cmpgt_epi16(v, c7F), _mm256_cmpgt_epi16(cA0, v))));
+				}
+
+				if (!_mm256_testz_si256(bad, bad)) break;
+			}
+		}
+		else
+		{
+			const __m256i	 c20 = _mm256_set1_epi32(0x20), c7F = _mm256_set1_epi32(0x7F);
+			const __m256i	 cA0 = _mm256_set1_epi32(0xA0), cFF = _mm256_set1_epi32(0xFF);
+
+			for (; i + 32 <= count; i += 32)
+			{
+				__m256i	 bad = _mm256_setzero_si256();
+
+				for (Int j = 0; j < 32; j += 8)
+				{
+					__m256i	 v = _mm256_loadu_si256((const __m256i *) (in + i + j));
+
+					bad = _mm256_or_si256(bad, _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(c20, v), _mm256_cmpgt_epi32(v, cFF)),
+										   _mm256_and_si256(_mm256_cmpgt_epi32(v, c7F), _mm256_cmpgt_epi32(cA0, v))));
+				}
+
+				if (!_mm256_testz_si256(bad, bad)) break;
+			}
+		}
+
+		return i + ScanANSISSE2(in + i, count - i);
+	}
+
+	SMOOTH_TARGET("avx2") static Int CaseASCIIAVX2(const wchar_t *in, wchar_t *out, Int count, wchar_t first)
+	{
+		Int	 i = 0;
+
+		if (sizeof(wchar_t) == 2)
+		{
+			const __m256i	 mask  = _mm256_set1_epi16(~0x7F), c20   = _mm256_set1_epi16(0x20);
+			const __m256i	 lower = _mm256_set1_epi16(first - 1), upper = _mm256_set1_epi16(first + 26);
+
+			for (; i + 32 <= count; i += 32)
+			{
+				__m256i	 a = _mm256_loadu_si256((const __m256i *) (in + i     ));
+				__m256i	 b = _mm256_loadu_si256((const __m256i *) (in + i + 16));
+
+				if (!_mm256_testz_si256(_mm256_or_si256(a, b), mask)) break;
+
+				_mm256_storeu_si256((__m256i *) (out + i     ), _mm256_xor_si256(a, _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi16(a, lower), _mm256_cmpgt_epi16(upper, a)), c20)));
+				_mm256_storeu_si256((__m256i *) (out + i + 16), _mm256_xor_si256(b, _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi16(b, lower), _mm256_cmpgt_epi16(upper, b)), c20)));
+			}
+		}
+		else
+		{
+			const __m256i	 mask  = _mm256_set1_epi32(~0x7F), c20   = _mm256_set1_epi32(0x20);
+			const __m256i	 lower = _mm256_set1_epi32(first - 1), upper = _mm256_set1_epi32(first + 26);
+
+			for (; i + 32 <= count; i += 32)
+			{
+				__m256i	 v[4];
+
+				for (Int j = 0; j < 4; j++) v[j] = _mm256_loadu_si256((const __m256i *) (in + i + 8 * j));
+
+				if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(v[0], v[1]), _mm256_or_si256(v[2], v[3])), mask)) break;
+
+				for (Int j = 0; j < 4; j++) _mm256_storeu_si256((__m256i *) (out + i + 8 * j), _mm256_xor_si256(v[j], _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(v[j], lower), _mm256_cmpgt_epi32(upper, v[j])), c20)));
+			}
+		}
+
+		return i + CaseASCIISSE2(in + i, out + i, count - i, first);
+	}
+#endif
+
+#ifdef SMOOTH_SIMD_NEON
+	/* NEON kernels processing 16 characters per iteration.
+	 */
+	static Int WidenASCIINEON(const char *in, wchar_t *out, Int count)
+	{
+		Int	 i = 0;
+
+		for (; i + 16 <= count; i += 16)
+		{
+			uint8x16_t	 v = vld1q_u8((const uint8_t *) (in + i));
+
+			if (vmaxvq_u8(v) >= 0x80) break;
+
+			uint16x8_t	 lo = vmovl_u8(vget_low_u8(v));
+			uint16x8_t	 hi = vmovl_u8(vget_high_u8(v));
+
+			if (sizeof(wchar_t) == 2)
+			{
+				vst1q_u16((uint16_t *) (out + i    ), lo);
+				vst1q_u16((uint16_t *) (out + i + 8), hi);
+			}
+			else
+			{
+				vst1q_u32((uint32_t *) (out + i     ), vmovl_u16(vget_low_u16(lo)));
+				vst1q_u32((uint32_t *) (out + i +  4), vmovl_u16(vget_high_u16(lo)));
+				vst1q_u32((uint32_t *) (out + i +  8), vmovl_u16(vget_low_u16(hi)));
+				vst1q_u32((uint32_t *) (out + i + 12), vmovl_u16(vget_high_u16(hi)));
+			}
+		}
+
+		return i + WidenASCIIScalar(in + i, out + i, count - i);
+	}
+
+	static Int NarrowASCIINEON(const wchar_t *in, char *out, Int count)
+	{
+		Int	 i = 0;
+
+		if (sizeof(wchar_t) == 2)
+		{
+			for (; i + 16 <= count; i += 16)
+			{
+				uint16x8_t	 a = vld1q_u16((const uint16_t *) (in + i    ));
+				uint16x8_t	 b = vld1q_u16((const uint16_t *) (in + i + 8));
+
+				if (vmaxvq_u16(vorrq_u16(a, b)) >= 0x80) break;
+
+				vst1q_u8((uint8_t *) (out + i), vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+			}
+		}
+		else
+		{
+			for (; i + 16 <= count; i += 16)
+			{
+				uint32x4_t	 a = vld1q_u32((const uint32_t *) (in + i     ));
+				uint32x4_t	 b = vld1q_u32((const uint32_t *) (in + i +  4));
+				uint32x4_t	 c = vld1q_u32((const uint32_t *) (in + i +  8));
+				uint32x4_t	 d = vld1q_u32((const uint32_t *) (in + i + 12));
+
+				if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) break;
+
+				uint16x8_t	 ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+				uint16x8_t	 cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+
+				vst1q_u8((uint8_t *) (out + i), vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+			}
+		}
+
+		return i + NarrowASCIIScalar(in + i, out + i, count - i);
+	}
+
+	static Int ScanANSINEON(const wchar_t *in, Int count)
+	{
+		Int	 i = 0;
+
+		if (sizeof(wchar_t) == 2)
+		{
+			for (; i + 16 <= count; i += 16)
+			{
+				uint16x8_t	 bad = vdupq_n_u16(0);
+
+				for (Int j = 0; j < 16; j += 8)
+				{
+					uint16x8_t	 v = vld1q_u16((const uint16_t *) (in + i + j));
+
+					bad = vorrq_u16(bad, vorrq_u16(vorrq_u16(vcltq_u16(v, vdupq_n_u16(0x20)), vcgtq_u16(v, vdupq_n_u16(0xFF))),
+								       vandq_u16(vcgeq_u16(v, vdupq_n_u16(0x80)), vcltq_u16(v, vdupq_n_u16(0xA0)))));
+				}
+
+				if (vmaxvq_u16(bad) != 0) break;
+			}
+		}
+		else
+		{
+			for (; i + 16 <= count; i += 16)
+			{
+				uint32x4_t	 bad = vdupq_n_u32(0);
+
+				for (Int j = 0; j < 16; j += 4)
+				{
+					int32x4_t	 v = vld1q_s32((const int32_t *) (in + i + j));
+
+					bad = vorrq_u32(bad, vorrq_u32(vorrq_u32(vcltq_s32(v, vdupq_n_s32(0x20)), vcgtq_s32(v, vdupq_n_s32(0xFF))),
+								       vandq_u32(vcgeq_s32(v, vdupq_n_s32(0x80)), vcltq_s32(v, vdupq_n_s32(0xA0)))));
+				}
+
+				if (vmaxvq_u32(bad) != 0) break;
+			}
+		}
+
+		return i + ScanANSIScalar(in + i, count - i);
+	}
+
+	static Int CaseASCIINEON(const wchar_t *in, wchar_t *out, Int count, wchar_t first)
+	{
+		Int	 i = 0;
+
+		if (sizeof(wchar_t) == 2)
+		{
+			for (; i + 16 <= count; i += 16)
+			{
+				uint16x8_t	 a = vld1q_u16((const uint16_t *) (in + i    ));
+				uint16x8_t	 b = vld1q_u16((const uint16_t *) (in + i + 8));
+
+				if (vmaxvq_u16(vorrq_u16(a, b)) >= 0x80) break;
+
+				vst1q_u16((uint16_t *) (out + i    ), veorq_u16(a, vandq_u16(vcltq_u16(vsubq_u16(a, vdupq_n_u16(first)), vdupq_n_u16(26)), vdupq_n_u16(0x20))));
+				vst1q_u16((uint16_t *) (out + i + 8), veorq_u16(b, vandq_u16(vcltq_u16(vsubq_u16(b, vdupq_n_u16(first)), vdupq_n_u16(26)), vdupq_n_u16(0x20))));
+			}
+		}
+		else
+		{
+			for (; i + 16 <= count; i += 16)
+			{
+				uint32x4_t	 v[4];
+
+				for (Int j = 0; j < 4; j++) v[j] = vld1q_u32((const uint32_t *) (in + i + 4 * j));
+
+				if (vmaxvq_u32(vorrq_u32(vorrq_u32(v[0], v[1]), vorrq_u32(v[2], v[3]))) >= 0x80) break;
+
+				for (Int j = 0; j < 4; j++) vst1q_u32((uint32_t *) (out + i + 4 * j), veorq_u32(v[j], vandq_u32(vcltq_u32(vsubq_u32(v[j], vdupq_n_u32(first)), vdupq_n_u32(26)), vdupq_n_u32(0x20))));
+			}
+		}
+
+		return i + CaseASCIIScalar(in + i, out + i, count - i, first);
+	}
+#endif
+
+	/* Kernels usable before CPU detection ran.
+	 */
+#if defined SMOOTH_SIMD_NEON
+	WidenASCIIKernel	 WidenASCII  = &WidenASCIINEON;
+	NarrowASCIIKernel	 NarrowASCII = &NarrowASCIINEON;
+	ScanANSIKernel		 ScanANSI    = &ScanANSINEON;
+	CaseASCIIKernel		 CaseASCII   = &CaseASCIINEON;
+#elif defined SMOOTH_SIMD_SSE2
+	WidenASCIIKernel	 WidenASCII  = &WidenASCIISSE2;
+	NarrowASCIIKernel	 NarrowASCII = &NarrowASCIISSE2;
+	ScanANSIKernel		 ScanANSI    = &ScanANSISSE2;
+	CaseASCIIKernel		 CaseASCII   = &CaseASCIISSE2;
+#else
+	WidenASCIIKernel	 WidenASCII  = &WidenASCIIScalar;
+	NarrowASCIIKernel	 NarrowASCII = &NarrowASCIIScalar;
+	ScanANSIKernel		 ScanANSI    = &ScanANSIScalar;
+	CaseASCIIKernel		 CaseASCII   = &CaseASCIIScalar;
+#endif
+};
+
+S::Void S::SelectStringKernels()
+{
+#ifdef SMOOTH_SIMD_X86
+	System::CPU	 cpu;
+
+	if (cpu.HasAVX2())
+	{
+		WidenASCII  = &WidenASCIIAVX2;
+		NarrowASCII = &NarrowASCIIAVX2;
+		ScanANSI    = &ScanANSIAVX2;
+		CaseASCII   = &CaseASCIIAVX2;
+	}
+	else if (cpu.HasSSE2())
+	{
+		WidenASCII  = &WidenASCIISSE2;
+		NarrowASCII = &NarrowASCIISSE2;
+		ScanANSI    = &ScanANSISSE2;
+		CaseASCII   = &CaseASCIISSE2;
+	}
+	else
+	{
+		WidenASCII  = &WidenASCIIScalar;
+		NarrowASCII = &NarrowASCIIScalar;
+		ScanANSI    = &ScanANSIScalar;
+		CaseASCII   = &CaseASCIIScalar;
+	}
+#endif
+}
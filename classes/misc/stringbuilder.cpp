@@ -0,0 +1,277 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/misc/stringbuilder.h>
+#include <smooth/misc/math.h>
+
+#include "string_internal.h"
+
+#include <wchar.h>
+#include <string.h>
+
+S::StringBuilder::StringBuilder(Int capacity, Bool iChunked)
+{
+	length	  = 0;
+
+	chunked	  = iChunked;
+	chunkFill = 0;
+
+	Reserve(capacity);
+}
+
+S::StringBuilder::~StringBuilder()
+{
+	FreeChunks();
+}
+
+S::Void S::StringBuilder::FreeChunks()
+{
+	for (Int i = 0; i < chunks.Length(); i++) delete [] chunks.GetNth(i);
+
+	chunks.RemoveAll();
+
+	chunkFill = 0;
+}
+
+S::Void S::StringBuilder::Reserve(Int capacity)
+{
+	/* Chunks are allocated on demand.
+	 */
+	if (chunked || capacity <= 0) return;
+
+	string.Reserve(capacity + 1);
+}
+
+wchar_t *S::StringBuilder::Extend(Int count, Int &available)
+{
+	/* Return room for up to count characters. In linear
+	 * mode there is always room for all of them.
+	 */
+	if (!chunked)
+	{
+		string.Reserve(length + count + 1);
+
+		available = count;
+
+		return string.wString + length;
+	}
+
+	if (chunks.Length() == 0 || chunkFill == ChunkSize)
+	{
+		chunks.Add(new wchar_t [ChunkSize]);
+
+		chunkFill = 0;
+	}
+
+	available = Math::Min(count, ChunkSize - chunkFill);
+
+	return chunks.GetLast() + chunkFill;
+}
+
+S::Void S::StringBuilder::Commit(Int count)
+{
+	length += count;
+
+	if (chunked) chunkFill += count;
+}
+
+S::Void S::StringBuilder::AppendChars(const wchar_t *chars, Int count)
+{
+	while (count > 0)
+	{
+		Int	 available = 0;
+		wchar_t	*buffer	   = Extend(count, available);
+
+		wmemcpy(buffer, chars, available);
+
+		Commit(available);
+
+		chars += available;
+		count -= available;
+	}
+}
+
+S::Void S::StringBuilder::AppendInteger(UnsignedInt64 value, Bool negative)
+{
+	/* Write digits back to front into a local buffer.
+	 */
+	wchar_t	 digits[24];
+	Int	 first = 24;
+
+	do
+	{
+		digits[--first] = '0' + value % 10;
+
+		value /= 10;
+	}
+	while (value > 0);
+
+	if (negative) digits[--first] = '-';
+
+	AppendChars(digits + first, 24 - first);
+}
+
+S::StringBuilder &S::StringBuilder::Append(const String &str)
+{
+	if (str.wString.Size() > 0) AppendChars(str.wString, str.Length());
+
+	return *this;
+}
+
+S::StringBuilder &S::StringBuilder::Append(const char *str)
+{
+	if (str == NIL) return *this;
+
+	Int	 count = strlen(str);
+
+	/* Widen ASCII characters directly if
+	 * the input format is a superset of ASCII.
+	 */
+	if (IsASCIICompatible(String::GetInputFormat()))
+	{
+		while (count > 0)
+		{
+			Int	 available = 0;
+			wchar_t	*buffer	   = Extend(count, available);
+			Int	 done	   = WidenASCII(str, buffer, available);
+
+			Commit(done);
+
+			str   += done;
+			count -= done;
+
+			if (done < available) break;
+		}
+
+		if (count == 0) return *this;
+	}
+
+	/* Convert remaining characters the regular way.
+	 */
+	return Append(String(str));
+}
+
+S::StringBuilder &S::StringBuilder::Append(const wchar_t *str)
+{
+	if (str != NIL) AppendChars(str, wcslen(str));
+
+	return *this;
+}
+
+S::StringBuilder &S::StringBuilder::AppendChar(wchar_t c)
+{
+	if (!chunked && length + 1 < string.wString.Size())
+	{
+		string.wString[length++] = c;
+
+		return *this;
+	}
+
+	AppendChars(&c, 1);
+
+	return *this;
+}
+
+S::StringBuilder &S::StringBuilder::Append(Int value)
+{
+	return Append((Int64) value);
+}
+
+S::StringBuilder &S::StringBuilder::Append(Int64 value)
+{
+	AppendInteger(value < 0 ? 0 - (UnsignedInt64) value : (UnsignedInt64) value, value < 0);
+
+	return *this;
+}
+
+S::StringBuilder &S::StringBuilder::Append(Float value)
+{
+	/* Produce the same output as String::FromFloat.
+	 */
+	const Int	 digits	  = 10;
+	Float		 absolute = Math::Abs(value);
+	Int64		 fract	  = (Int64) (Math::Fract(absolute) * Math::Pow(10, digits));
+	Int		 lead	  = digits - Math::Floor((fract > 0 ? Math::Log10(fract) : -1) + 1.000000001);
+
+	Int	 nOfNull = 0;
+	Int	 nOfNine = 0;
+	Int64	 divisor = 1;
+
+	for (Int i = 0; i < digits && (fract / divisor) % 10 == 0; i++, divisor *= 10) nOfNull++;
+
+	divisor = 1;
+
+	for (Int i = 0; i < digits && (fract / divisor) % 10 == 9; i++, divisor *= 10) nOfNine++;
+
+	if	(nOfNull > 0) fract = fract / (Int64) Math::Pow(10, nOfNull);
+	else if (nOfNine > 0) fract = fract / (Int64) Math::Pow(10, nOfNine) + 1;
+
+	if (value < 0) AppendChar('-');
+
+	if (nOfNine == digits)
+	{
+		AppendInteger((Int64) (Math::Floor(absolute) + 1), False);
+	}
+	else
+	{
+		AppendInteger((Int64) Math::Floor(absolute), False);
+
+		if (fract > 0)
+		{
+			AppendChar('.');
+
+			for (Int i = 0; i < lead; i++) AppendChar('0');
+
+			AppendInteger(fract, False);
+		}
+	}
+
+	return *this;
+}
+
+S::String S::StringBuilder::Finish()
+{
+	String	 result;
+
+	if (length == 0) return result;
+
+	if (!chunked)
+	{
+		/* Hand our buffer over to the result.
+		 */
+		string.Reserve(length + 1);
+		string.wString[length] = 0;
+
+		result.wString.Swap(string.wString);
+	}
+	else
+	{
+		/* Join chunks into the result.
+		 */
+		result.wString.Resize(length + 1);
+
+		for (Int i = 0; i < chunks.Length(); i++)
+		{
+			Int	 count = (i < chunks.Length() - 1 ? ChunkSize : chunkFill);
+
+			wmemcpy(result.wString + i * ChunkSize, chunks.GetNth(i), count);
+		}
+
+		result.wString[length] = 0;
+
+		FreeChunks();
+	}
+
+	result.stringLength = length;
+
+	length = 0;
+
+	return result;
+}
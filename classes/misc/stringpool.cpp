@@ -0,0 +1,197 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/misc/stringpool.h>
+#include <smooth/misc/hash/wyhash.h>
+#include <smooth/threads/atomic.h>
+
+using namespace smooth::Threads;
+
+namespace smooth
+{
+	class StringPoolEntry
+	{
+		public:
+			UnsignedInt64	 hash;
+			String		 string;
+
+					 StringPoolEntry(UnsignedInt64 iHash, const String &iString) : hash(iHash), string(iString) { }
+	};
+
+	/* Open addressing table of pooled strings.
+	 *
+	 * Tables are replaced when growing, but kept until the pool
+	 * is destroyed, so readers may still use an old table.
+	 */
+	class StringPoolTable
+	{
+		public:
+			Int				 size;
+			StringPoolEntry * volatile	*entries;
+
+			StringPoolTable			*previous;
+
+							 StringPoolTable(Int iSize, StringPoolTable *iPrevious);
+							~StringPoolTable() { delete [] entries; }
+
+			Void				 Insert(StringPoolEntry *);
+	};
+
+	/* Global pool, created on first use
+	 * and deleted when the program exits.
+	 */
+	static StringPool * volatile	 globalPool = NIL;
+
+	static class StringPoolCleanup
+	{
+		public:
+			~StringPoolCleanup() { delete globalPool; }
+	} stringPoolCleanup;
+};
+
+S::StringPoolTable::StringPoolTable(Int iSize, StringPoolTable *iPrevious)
+{
+	size	 = iSize;
+	entries	 = new StringPoolEntry * volatile [size];
+
+	previous = iPrevious;
+
+	for (Int i = 0; i < size; i++) entries[i] = NIL;
+}
+
+S::Void S::StringPoolTable::Insert(StringPoolEntry *entry)
+{
+	Int	 slot = entry->hash & (size - 1);
+
+	while (entries[slot] != NIL) slot = (slot + 1) & (size - 1);
+
+	/* Publish the fully constructed entry.
+	 */
+	Atomic::Store(entries[slot], entry, MemoryOrderRelease);
+}
+
+S::StringPool &S::StringPool::GetGlobal()
+{
+	StringPool	*pool = Atomic::Load(globalPool, MemoryOrderAcquire);
+
+	if (pool != NIL) return *pool;
+
+	/* Create pool, handling the case that another
+	 * thread does the same at the same time.
+	 */
+	StringPool	*expected = NIL;
+
+	pool = new StringPool();
+
+	if (Atomic::CompareExchange(globalPool, expected, pool, MemoryOrderAcquireRelease)) return *pool;
+
+	delete pool;
+
+	return *expected;
+}
+
+S::StringPool::StringPool()
+{
+	table	   = NIL;
+	nOfStrings = 0;
+
+	seed	   = Hash::WyHash::GetRandomSeed();
+}
+
+S::StringPool::~StringPool()
+{
+	if (table == NIL) return;
+
+	/* The current table refers to all entries.
+	 */
+	for (Int i = 0; i < table->size; i++) delete table->entries[i];
+
+	while (table != NIL)
+	{
+		StringPoolTable	*previous = table->previous;
+
+		delete table;
+
+		table = previous;
+	}
+}
+
+S::Int S::StringPool::Length() const
+{
+	return Atomic::Load(nOfStrings, MemoryOrderRelaxed);
+}
+
+const S::String *S::StringPool::Lookup(const StringPoolTable *current, const String &string, UnsignedInt64 hash) const
+{
+	if (current == NIL) return NIL;
+
+	Int	 mask = current->size - 1;
+
+	for (Int slot = hash & mask; ; slot = (slot + 1) & mask)
+	{
+		const StringPoolEntry	*entry = Atomic::Load(current->entries[slot], MemoryOrderAcquire);
+
+		if (entry == NIL) return NIL;
+
+		if (entry->hash == hash && entry->string == string) return &entry->string;
+	}
+}
+
+const S::String *S::StringPool::Find(const String &string) const
+{
+	return Lookup(Atomic::Load(table, MemoryOrderAcquire), string, string.ComputeHash(seed));
+}
+
+const S::String *S::StringPool::Intern(const String &string)
+{
+	UnsignedInt64	 hash	= string.ComputeHash(seed);
+	const String	*pooled = Lookup(Atomic::Load(table, MemoryOrderAcquire), string, hash);
+
+	if (pooled != NIL) return pooled;
+
+	/* Check again with the lock held as another
+	 * thread might have added the string meanwhile.
+	 */
+	Lock		 lock(mutex);
+	StringPoolTable	*current = table;
+
+	pooled = Lookup(current, string, hash);
+
+	if (pooled != NIL) return pooled;
+
+	/* Grow table keeping load factor at or below one half.
+	 */
+	if (current == NIL || (nOfStrings + 1) * 2 > current->size)
+	{
+		StringPoolTable	*grown = new StringPoolTable(current == NIL ? 64 : current->size * 2, current);
+
+		for (Int i = 0; current != NIL && i < current->size; i++)
+		{
+			if (current->entries[i] != NIL) grown->Insert(current->entries[i]);
+		}
+
+		Atomic::Store(table, grown, MemoryOrderRelease);
+
+		current = grown;
+	}
+
+	/* Add new entry. Make sure the string length is
+	 * cached before other threads can access it.
+	 */
+	StringPoolEntry	*entry = new StringPoolEntry(hash, string);
+
+	entry->string.Length();
+
+	current->Insert(entry);
+
+	Atomic::Store(nOfStrings, nOfStrings + 1, MemoryOrderRelaxed);
+
+	return &entry->string;
+}
@@ -0,0 +1,181 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/misc/stringview.h>
+#include <smooth/misc/math.h>
+
+#include "string_internal.h"
+
+#include <wchar.h>
+
+namespace smooth
+{
+	static inline Bool IsSpace(wchar_t c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\0' || c == '\x0B';
+	}
+};
+
+S::StringView::StringView(const String &string)
+{
+	chars  = string.wString;
+	length = chars != NIL ? string.Length() : 0;
+}
+
+S::Int S::StringView::Find(const StringView &view) const
+{
+	if (view.length == 0) return 0;
+
+	return FindChars(chars, length, view.chars, view.length);
+}
+
+S::Int S::StringView::FindLast(const StringView &view) const
+{
+	return FindLastChars(chars, length, view.chars, view.length);
+}
+
+S::Int S::StringView::Compare(const StringView &view) const
+{
+	if	(length != view.length)					       return length - view.length;
+	else if (length > 0 && wmemcmp(chars, view.chars, length) != 0) return 1;
+
+	return 0;
+}
+
+S::Bool S::StringView::StartsWith(const StringView &view) const
+{
+	if (length < view.length) return False;
+
+	return view.length == 0 || wmemcmp(chars, view.chars, view.length) == 0;
+}
+
+S::Bool S::StringView::EndsWith(const StringView &view) const
+{
+	if (length < view.length) return False;
+
+	return view.length == 0 || wmemcmp(chars + length - view.length, view.chars, view.length) == 0;
+}
+
+S::StringView S::StringView::SubString(Int start, Int number) const
+{
+	if (number <= 0 || start < 0 || start >= length) return StringView();
+
+	return StringView(chars + start, Math::Min(number, length - start));
+}
+
+S::StringView S::StringView::Head(Int n) const
+{
+	return SubString(0, n);
+}
+
+S::StringView S::StringView::Tail(Int n) const
+{
+	return SubString(length - n, n);
+}
+
+S::StringView S::StringView::Trim() const
+{
+	Int	 first = 0;
+	Int	 last  = length;
+
+	while (first < last && IsSpace(chars[first]))	 first++;
+	while (last > first && IsSpace(chars[last - 1])) last--;
+
+	return SubString(first, last - first);
+}
+
+S::Int64 S::StringView::ToInt() const
+{
+	if (length == 0) return 0;
+
+	Int	 sign = (chars[0] == '-' ? -1 : 1);
+	Int	 i    = (chars[0] == '-' || chars[0] == '+' ? 1 : 0);
+
+	Int64	 value = 0;
+
+	for (; i < length && chars[i] >= '0' && chars[i] <= '9'; i++) value = value * 10 + (chars[i] - '0');
+
+	return value * sign;
+}
+
+S::Float S::StringView::ToFloat() const
+{
+	if (length == 0) return 0;
+
+	Int	 sign = (chars[0] == '-' ? -1 : 1);
+	Int	 i    = (chars[0] == '-' || chars[0] == '+' ? 1 : 0);
+
+	Int64	 integer = 0;
+
+	for (; i < length && chars[i] >= '0' && chars[i] <= '9'; i++) integer = integer * 10 + (chars[i] - '0');
+
+	Float	 value = integer;
+
+	/* Add fractional digits if any.
+	 */
+	if (i < length && chars[i] == '.')
+	{
+		for (Int n = 1; ++i < length && chars[i] >= '0' && chars[i] <= '9'; n++) value += Float(chars[i] - '0') * Math::Pow(10, -n);
+	}
+
+	return value * sign;
+}
+
+S::String S::StringView::ToString() const
+{
+	if (length == 0) return NIL;
+
+	String	 string;
+
+	string.wString.Resize(length + 1);
+
+	wmemcpy(string.wString, chars, length);
+
+	string.wString[length] = 0;
+	string.stringLength    = length;
+
+	return string;
+}
+
+S::Bool S::StringView::operator ==(const StringView &view) const
+{
+	return Compare(view) == 0;
+}
+
+S::Bool S::StringView::operator !=(const StringView &view) const
+{
+	return Compare(view) != 0;
+}
+
+S::StringTokenizer::StringTokenizer(const StringView &iString, const String &iDelimiter) : string(iString), delimiter(iDelimiter)
+{
+	position = 0;
+}
+
+S::Bool S::StringTokenizer::Next(StringView &token)
+{
+	Int	 length = string.Length();
+
+	if (position >= length) return False;
+
+	/* Return the rest of the string if there
+	 * is no further delimiter.
+	 */
+	StringView	 rest  = string.SubString(position, length - position);
+	Int		 count = delimiter.Length();
+	Int		 index = count > 0 ? rest.Find(delimiter) : -1;
+
+	if (index == -1) index = rest.Length();
+
+	token	  = rest.Head(index);
+	position += index + count;
+
+	return True;
+}
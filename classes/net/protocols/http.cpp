@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2022 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -18,6 +18,7 @@
 #include <smooth/io/drivers/driver_socks5.h>
 #include <smooth/misc/math.h>
 #include <smooth/misc/number.h>
+#include <smooth/misc/stringbuilder.h>
 #include <smooth/system/system.h>
 #include <smooth/foreach.h>
 #include <smooth/version.h>
@@ -195,7 +196,12 @@ S::Int S::Net::Protocols::HTTP::DownloadToFile(const String &fileName)
 
 	/* Set headers.
 	 */
-	foreach (const Parameter &field, requestFields) headers = curl_slist_append(headers, String(field.key).Append(": ").Append(field.value));
+	foreach (const Parameter &field, requestFields)
+	{
+		StringBuilder	 header(field.key.Length() + field.value.Length() + 2);
+
+		headers = curl_slist_append(headers, header.Append(field.key).Append(": ").Append(field.value).Finish());
+	}
 
 	/* Check to see if we are to transfer any files.
 	 */
@@ -349,18 +355,18 @@ S::Int S::Net::Protocols::HTTP::DownloadToFile(const String &fileName)
 
 S::String S::Net::Protocols::HTTP::GetParametersURLEncoded() const
 {
-	String	 str;
+	StringBuilder	 builder;
 
 	for (Int i = 0; i < requestParameters.Length(); i++)
 	{
 		const Parameter	&parameter = requestParameters.GetNth(i);
 
-		if (i > 0) str.Append("&");
+		if (i > 0) builder.AppendChar('&');
 
-		str.Append(parameter.key).Append("=").Append(parameter.value);
+		builder.Append(parameter.key).AppendChar('=').Append(parameter.value);
 	}
 
-	return str;
+	return builder.Finish();
 }
 
 size_t S::Net::Protocols::httpHeader(char *buffer, size_t size, size_t n, void *data)
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2023 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -12,6 +12,15 @@
 
 #include <libcpuid/libcpuid.h>
 
+#if defined __linux__ && defined __aarch64__
+#	include <sys/auxv.h>
+#	include <asm/hwcap.h>
+#elif defined __WIN32__ && (defined __aarch64__ || defined _M_ARM64)
+#	include <windows.h>
+#elif defined _MSC_VER && (defined _M_IX86 || defined _M_X64)
+#	include <immintrin.h>
+#endif
+
 S::String	 S::System::CPU::vendorString;
 S::String	 S::System::CPU::brandString;
 
@@ -32,6 +41,11 @@ S::Bool		 S::System::CPU::hasSSE4a	= False;
 S::Bool		 S::System::CPU::hasAVX		= False;
 S::Bool		 S::System::CPU::hasAVX2	= False;
 
+S::Bool		 S::System::CPU::hasPCLMUL	= False;
+S::Bool		 S::System::CPU::hasPMULL	= False;
+
+S::Bool		 S::System::CPU::hasSHA		= False;
+
 S::Bool		 S::System::CPU::has3DNow	= False;
 S::Bool		 S::System::CPU::has3DNowExt	= False;
 
@@ -41,6 +55,25 @@ S::Bool		 S::System::CPU::hasNX		= False;
 S::Bool		 S::System::CPU::hasVMX		= False;
 S::Bool		 S::System::CPU::hasSVM		= False;
 
+/* Read the XCR0 register telling which register
+ * states are saved and restored by the OS.
+ */
+static S::UnsignedInt64 ReadXCR0()
+{
+#if defined __GNUC__ && (defined __i386__ || defined __x86_64__)
+	S::UnsignedInt32	 eax = 0;
+	S::UnsignedInt32	 edx = 0;
+
+	__asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+
+	return ((S::UnsignedInt64) edx << 32) | eax;
+#elif defined _MSC_VER && (defined _M_IX86 || defined _M_X64)
+	return _xgetbv(0);
+#else
+	return 0;
+#endif
+}
+
 S::System::CPU::CPU()
 {
 	GetCPUID();
@@ -76,6 +109,16 @@ S::Errors::Error S::System::CPU::GetCPUID() const
 		if (numCores >= 6) numCores -= 4;
 #endif
 
+		/* Query ARM crypto extensions from the OS.
+		 */
+#if defined __APPLE__ && defined __aarch64__
+		hasPMULL       = True;
+#elif defined __linux__ && defined __aarch64__
+		hasPMULL       = (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+#elif defined __WIN32__ && (defined __aarch64__ || defined _M_ARM64)
+		hasPMULL       = IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE);
+#endif
+
 		return Success();
 	}
 
@@ -135,8 +178,17 @@ S::Errors::Error S::System::CPU::GetCPUID() const
 	hasSSE4_2      = data.flags[CPU_FEATURE_SSE4_2];
 	hasSSE4a       = data.flags[CPU_FEATURE_SSE4A];
 
-	hasAVX	       = data.flags[CPU_FEATURE_AVX];
-	hasAVX2	       = data.flags[CPU_FEATURE_AVX2];
+	/* AVX can only be used if the OS saves and restores
+	 * the SSE and AVX register states on context switches.
+	 */
+	Bool	 hasAVXState   = data.flags[CPU_FEATURE_OSXSAVE] && (ReadXCR0() & 6) == 6;
+
+	hasAVX	       = data.flags[CPU_FEATURE_AVX]  && hasAVXState;
+	hasAVX2	       = data.flags[CPU_FEATURE_AVX2] && hasAVXState;
+
+	hasPCLMUL      = data.flags[CPU_FEATURE_PCLMUL];
+
+	hasSHA	       = data.flags[CPU_FEATURE_SHA_NI];
 
 	has3DNow       = data.flags[CPU_FEATURE_3DNOW];
 	has3DNowExt    = data.flags[CPU_FEATURE_3DNOWEXT];
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -68,10 +68,20 @@ S::Int S::Threads::ThreadCocoa::Start(Void (*threadProc)(Void *), Void *threadPa
 	if (limit.rlim_cur >= PTHREAD_STACK_MIN &&
 	    limit.rlim_cur != RLIM_INFINITY) pthread_attr_setstacksize(&attributes, limit.rlim_cur);
 
-	pthread_create(thread, &attributes, Caller, &info);
+	Int	 result = pthread_create(thread, &attributes, Caller, &info);
 
 	pthread_attr_destroy(&attributes);
 
+	if (result != 0)
+	{
+		delete thread;
+
+		thread	 = NIL;
+		myThread = False;
+
+		return Error();
+	}
+
 	return Success();
 }
 
@@ -0,0 +1,329 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/threads/backends/posix/rwlockposix.h>
+#include <smooth/threads/atomic.h>
+
+namespace smooth
+{
+	namespace Threads
+	{
+		/* Lock state flags. The waiting flag is set while a writer waits
+		 * for readers to finish or for another writer to release the lock,
+		 * the active flag is set while a writer holds the lock. The
+		 * remaining bits count active readers.
+		 */
+		static const Int		 RWLOCK_WRITER_WAITING = 0x40000000;
+		static const Int		 RWLOCK_WRITER_ACTIVE  = 0x20000000;
+		static const Int		 RWLOCK_WRITER	       = RWLOCK_WRITER_WAITING | RWLOCK_WRITER_ACTIVE;
+		static const Int		 RWLOCK_READERS	       = 0x1FFFFFFF;
+
+		/* Read locks held by the current thread, counted per lock.
+		 *
+		 * Holds must be recorded on the fast path as well, as a writer
+		 * may start waiting at any time while they are held. Holds are
+		 * only consulted when a writer is waiting.
+		 *
+		 * Locks not fitting into the table are counted as overflow.
+		 * While there is overflow, any lock is considered held.
+		 */
+		class ReadLockHolds
+		{
+			public:
+				static const Int	 Size = 8;
+
+				const RWLockPOSIX	*locks[Size];
+				Int			 counts[Size];
+
+				Int			 nOfLocks;
+				Int			 overflow;
+
+							 ReadLockHolds() : nOfLocks(0), overflow(0) { }
+		};
+
+		static pthread_once_t	 readLockHoldsOnce = PTHREAD_ONCE_INIT;
+		static pthread_key_t	 readLockHoldsKey;
+
+		static void FreeReadLockHolds(void *holds)
+		{
+			delete (ReadLockHolds *) holds;
+		}
+
+		static void CreateReadLockHoldsKey()
+		{
+			pthread_key_create(&readLockHoldsKey, &FreeReadLockHolds);
+		}
+
+		static ReadLockHolds *GetReadLockHolds()
+		{
+			pthread_once(&readLockHoldsOnce, &CreateReadLockHoldsKey);
+
+			ReadLockHolds	*holds = (ReadLockHolds *) pthread_getspecific(readLockHoldsKey);
+
+			if (holds == NIL)
+			{
+				holds = new ReadLockHolds();
+
+				pthread_setspecific(readLockHoldsKey, holds);
+			}
+
+			return holds;
+		}
+
+		static Bool HoldsReadLock(const RWLockPOSIX *lock)
+		{
+			ReadLockHolds	*holds = GetReadLockHolds();
+
+			if (holds->overflow > 0) return True;
+
+			for (Int i = 0; i < holds->nOfLocks; i++) if (holds->locks[i] == lock) return True;
+
+			return False;
+		}
+
+		static Void AddReadHold(const RWLockPOSIX *lock)
+		{
+			ReadLockHolds	*holds = GetReadLockHolds();
+
+			for (Int i = 0; i < holds->nOfLocks; i++) if (holds->locks[i] == lock) { holds->counts[i]++; return; }
+
+			if (holds->nOfLocks == ReadLockHolds::Size) { holds->overflow++; return; }
+
+			holds->locks[holds->nOfLocks]  = lock;
+			holds->counts[holds->nOfLocks] = 1;
+
+			holds->nOfLocks++;
+		}
+
+		static Void RemoveReadHold(const RWLockPOSIX *lock)
+		{
+			ReadLockHolds	*holds = GetReadLockHolds();
+
+			for (Int i = 0; i < holds->nOfLocks; i++)
+			{
+				if (holds->locks[i] != lock) continue;
+
+				if (--holds->counts[i] == 0)
+				{
+					holds->nOfLocks--;
+
+					holds->locks[i]	 = holds->locks[holds->nOfLocks];
+					holds->counts[i] = holds->counts[holds->nOfLocks];
+				}
+
+				return;
+			}
+
+			if (holds->overflow > 0) holds->overflow--;
+		}
+	};
+};
+
+S::Threads::RWLockBackend *CreateRWLockPOSIX()
+{
+	return new S::Threads::RWLockPOSIX();
+}
+
+S::Int	 rwlockPOSIXTmp = S::Threads::RWLockBackend::SetBackend(&CreateRWLockPOSIX);
+
+S::Threads::RWLockPOSIX::RWLockPOSIX() : RWLockBackend(RWLOCK_POSIX)
+{
+	state	       = 0;
+
+	writerActive   = False;
+
+	waitingReaders = 0;
+	waitingWriters = 0;
+
+	owner	       = 0;
+	ownerDepth     = 0;
+
+	pthread_mutex_init(&mutex, NIL);
+
+	pthread_cond_init(&readersCondition, NIL);
+	pthread_cond_init(&writersCondition, NIL);
+	pthread_cond_init(&drainCondition, NIL);
+}
+
+S::Threads::RWLockPOSIX::~RWLockPOSIX()
+{
+	pthread_cond_destroy(&readersCondition);
+	pthread_cond_destroy(&writersCondition);
+	pthread_cond_destroy(&drainCondition);
+
+	pthread_mutex_destroy(&mutex);
+}
+
+S::Bool S::Threads::RWLockPOSIX::IsOwner() const
+{
+	intptr_t	 current = Atomic::Load(owner, MemoryOrderRelaxed);
+
+	return current != 0 && current == (intptr_t) pthread_self();
+}
+
+S::Bool S::Threads::RWLockPOSIX::LockForRead()
+{
+	/* Read locks taken by the writer just nest.
+	 */
+	if (IsOwner()) { ownerDepth++; return True; }
+
+	/* Fast path if no writer is active or waiting.
+	 */
+	Int	 previous = Atomic::FetchAdd(state, 1, MemoryOrderAcquire);
+
+	if (!(previous & RWLOCK_WRITER)) { AddReadHold(this); return True; }
+
+	/* Do not wait for pending writers if we already hold a read lock on
+	 * this lock as the writer would in turn wait for us to release it.
+	 */
+	if (!(previous & RWLOCK_WRITER_ACTIVE) && HoldsReadLock(this)) { AddReadHold(this); return True; }
+
+	ReleaseRead();
+
+	/* Wait for writers to finish.
+	 */
+	pthread_mutex_lock(&mutex);
+
+	readContention++;
+
+	while (True)
+	{
+		waitingReaders++;
+
+		while (Atomic::Load(state, MemoryOrderRelaxed) & RWLOCK_WRITER) pthread_cond_wait(&readersCondition, &mutex);
+
+		waitingReaders--;
+
+		previous = Atomic::FetchAdd(state, 1, MemoryOrderAcquire);
+
+		if (!(previous & RWLOCK_WRITER)) break;
+
+		/* Another writer came in between, back off.
+		 */
+		previous = Atomic::FetchSub(state, 1, MemoryOrderRelaxed);
+
+		if ((previous & RWLOCK_READERS) == 1) pthread_cond_signal(&drainCondition);
+	}
+
+	pthread_mutex_unlock(&mutex);
+
+	AddReadHold(this);
+
+	return True;
+}
+
+S::Bool S::Threads::RWLockPOSIX::LockForWrite()
+{
+	/* Write locks may be nested.
+	 */
+	if (IsOwner()) { ownerDepth++; return True; }
+
+	pthread_mutex_lock(&mutex);
+
+	/* Wait for other writers to finish.
+	 */
+	Atomic::FetchOr(state, RWLOCK_WRITER_WAITING, MemoryOrderRelaxed);
+
+	if (writerActive)
+	{
+		writeContention++;
+		waitingWriters++;
+
+		while (writerActive) pthread_cond_wait(&writersCondition, &mutex);
+
+		waitingWriters--;
+	}
+
+	writerActive = True;
+
+	/* Wait for active readers to finish.
+	 */
+	Bool	 contended = False;
+
+	while (True)
+	{
+		Int	 current = Atomic::Load(state, MemoryOrderRelaxed);
+
+		if (current & RWLOCK_READERS)
+		{
+			if (!contended) writeContention++;
+
+			contended = True;
+
+			pthread_cond_wait(&drainCondition, &mutex);
+		}
+		else if (Atomic::CompareExchange(state, current, current | RWLOCK_WRITER_ACTIVE, MemoryOrderAcquire))
+		{
+			break;
+		}
+	}
+
+	Atomic::Store(owner, (intptr_t) pthread_self(), MemoryOrderRelaxed);
+
+	ownerDepth = 1;
+
+	pthread_mutex_unlock(&mutex);
+
+	return True;
+}
+
+S::Bool S::Threads::RWLockPOSIX::Release()
+{
+	if (!IsOwner())
+	{
+		RemoveReadHold(this);
+
+		ReleaseRead();
+
+		return True;
+	}
+
+	if (--ownerDepth > 0) return True;
+
+	/* Hand over to the next writer if any
+	 * or let waiting readers continue.
+	 */
+	pthread_mutex_lock(&mutex);
+
+	Atomic::Store(owner, (intptr_t) 0, MemoryOrderRelaxed);
+
+	writerActive = False;
+
+	if (waitingWriters > 0)
+	{
+		Atomic::FetchAnd(state, ~RWLOCK_WRITER_ACTIVE, MemoryOrderRelease);
+
+		pthread_cond_signal(&writersCondition);
+	}
+	else
+	{
+		Atomic::FetchAnd(state, ~RWLOCK_WRITER, MemoryOrderRelease);
+
+		if (waitingReaders > 0) pthread_cond_broadcast(&readersCondition);
+	}
+
+	pthread_mutex_unlock(&mutex);
+
+	return True;
+}
+
+S::Void S::Threads::RWLockPOSIX::ReleaseRead()
+{
+	Int	 previous = Atomic::FetchSub(state, 1, MemoryOrderRelease);
+
+	/* Wake up writer waiting for the last reader.
+	 */
+	if ((previous & RWLOCK_READERS) == 1 && (previous & RWLOCK_WRITER_WAITING))
+	{
+		pthread_mutex_lock(&mutex);
+		pthread_cond_signal(&drainCondition);
+		pthread_mutex_unlock(&mutex);
+	}
+}
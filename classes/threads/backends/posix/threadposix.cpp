@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -49,7 +49,15 @@ S::Int S::Threads::ThreadPOSIX::Start(Void (*threadProc)(Void *), Void *threadPa
 	thread	 = new pthread_t;
 	myThread = True;
 
-	pthread_create(thread, NULL, Caller, &info);
+	if (pthread_create(thread, NULL, Caller, &info) != 0)
+	{
+		delete thread;
+
+		thread	 = NIL;
+		myThread = False;
+
+		return Error();
+	}
 
 	return Success();
 }
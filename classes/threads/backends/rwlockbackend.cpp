@@ -0,0 +1,160 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/threads/backends/rwlockbackend.h>
+#include <smooth/threads/mutex.h>
+#include <smooth/system/system.h>
+
+S::Threads::RWLockBackend *CreateRWLockBackend()
+{
+	return new S::Threads::RWLockBackend();
+}
+
+S::Threads::RWLockBackend *(*S::Threads::RWLockBackend::backend_creator)() = &CreateRWLockBackend;
+
+S::Int S::Threads::RWLockBackend::SetBackend(RWLockBackend *(*backend)())
+{
+	if (backend == NIL) return Error();
+
+	backend_creator = backend;
+
+	return Success();
+}
+
+S::Threads::RWLockBackend *S::Threads::RWLockBackend::CreateBackendInstance()
+{
+	return backend_creator();
+}
+
+S::Threads::RWLockBackend::RWLockBackend()
+{
+	type = RWLOCK_NONE;
+
+	readLocked	= 0;
+	writeLocked	= 0;
+
+	readContention	= 0;
+	writeContention	= 0;
+
+	exclusiveAccessMutex = new Mutex();
+	sharedAccessMutex    = new Mutex();
+}
+
+S::Threads::RWLockBackend::RWLockBackend(Short iType)
+{
+	type = iType;
+
+	readLocked	= 0;
+	writeLocked	= 0;
+
+	readContention	= 0;
+	writeContention	= 0;
+
+	exclusiveAccessMutex = NIL;
+	sharedAccessMutex    = NIL;
+}
+
+S::Threads::RWLockBackend::~RWLockBackend()
+{
+	if (exclusiveAccessMutex != NIL) delete exclusiveAccessMutex;
+	if (sharedAccessMutex	 != NIL) delete sharedAccessMutex;
+}
+
+S::Short S::Threads::RWLockBackend::GetRWLockType() const
+{
+	return type;
+}
+
+/* Generic implementation based on two mutexes.
+ *
+ * Used on systems without a native read/write lock backend.
+ */
+S::Bool S::Threads::RWLockBackend::LockForRead()
+{
+	/* Acquire exclusive lock.
+	 */
+	exclusiveAccessMutex->Lock();
+
+	/* Increase read lock counter by one.
+	 */
+	sharedAccessMutex->Lock();
+
+	readLocked++;
+
+	sharedAccessMutex->Release();
+
+	/* Allow other read and write locks.
+	 */
+	exclusiveAccessMutex->Release();
+
+	return True;
+}
+
+S::Bool S::Threads::RWLockBackend::LockForWrite()
+{
+	/* Acquire exclusive lock.
+	 */
+	exclusiveAccessMutex->Lock();
+
+	/* Wait for read operations to finish.
+	 */
+	sharedAccessMutex->Lock();
+
+	if (readLocked) writeContention++;
+
+	while (readLocked)
+	{
+		sharedAccessMutex->Release();
+		exclusiveAccessMutex->Release();
+
+		S::System::System::Sleep(0);
+
+		exclusiveAccessMutex->Lock();
+		sharedAccessMutex->Lock();
+	}
+
+	/* Increase write lock counter.
+	 */
+	writeLocked++;
+
+	sharedAccessMutex->Release();
+
+	return True;
+}
+
+S::Bool S::Threads::RWLockBackend::Release()
+{
+	/* Check if we are locked for write.
+	 */
+	sharedAccessMutex->Lock();
+
+	if (writeLocked && !readLocked)
+	{
+		/* Decrease write lock counter.
+		 */
+		writeLocked--;
+
+		sharedAccessMutex->Release();
+
+		/* Allow new read and write locks again.
+		 */
+		exclusiveAccessMutex->Release();
+
+		return True;
+	}
+
+	/* Decrease read lock counter by one.
+	 */
+	readLocked--;
+
+	sharedAccessMutex->Release();
+
+	return True;
+}
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -50,6 +50,13 @@ S::Int S::Threads::ThreadWin32::Start(Void (*threadProc)(Void *), Void *threadPa
 	thread	 = CreateThread(NULL, 0, Caller, &info, 0, (DWORD *) &threadID);
 	myThread = True;
 
+	if (thread == NIL)
+	{
+		myThread = False;
+
+		return Error();
+	}
+
 	return Success();
 }
 
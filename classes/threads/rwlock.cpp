@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -8,16 +8,13 @@
   * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
   * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
 
-#include <smooth/threads/mutex.h>
-#include <smooth/system/system.h>
+#include <smooth/definitions.h>
+#include <smooth/threads/rwlock.h>
+#include <smooth/threads/backends/rwlockbackend.h>
 
 S::Threads::RWLock::RWLock()
 {
-	readLocked  = 0;
-	writeLocked = 0;
-
-	exclusiveAccessMutex = new Mutex();
-	sharedAccessMutex    = new Mutex();
+	backend = RWLockBackend::CreateBackendInstance();
 }
 
 S::Threads::RWLock::RWLock(const RWLock &oRWLock)
@@ -27,100 +24,44 @@ S::Threads::RWLock::RWLock(const RWLock &oRWLock)
 
 S::Threads::RWLock::~RWLock()
 {
-	delete exclusiveAccessMutex;
-	delete sharedAccessMutex;
+	delete backend;
 }
 
 S::Threads::RWLock &S::Threads::RWLock::operator =(const RWLock &oRWLock)
 {
 	if (&oRWLock == this) return *this;
 
-	readLocked  = 0;
-	writeLocked = 0;
-
-	exclusiveAccessMutex = new Mutex();
-	sharedAccessMutex    = new Mutex();
+	backend = RWLockBackend::CreateBackendInstance();
 
 	return *this;
 }
 
-S::Bool S::Threads::RWLock::LockForRead()
+S::Int S::Threads::RWLock::GetRWLockType() const
 {
-	/* Acquire exclusive lock.
-	 */
-	exclusiveAccessMutex->Lock();
-
-	/* Increase read lock counter by one.
-	 */
-	sharedAccessMutex->Lock();
-
-	readLocked++;
+	return backend->GetRWLockType();
+}
 
-	sharedAccessMutex->Release();
+S::Int S::Threads::RWLock::GetReadContention() const
+{
+	return backend->GetReadContention();
+}
 
-	/* Allow other read and write locks.
-	 */
-	exclusiveAccessMutex->Release();
+S::Int S::Threads::RWLock::GetWriteContention() const
+{
+	return backend->GetWriteContention();
+}
 
-	return True;
+S::Bool S::Threads::RWLock::LockForRead()
+{
+	return backend->LockForRead();
 }
 
 S::Bool S::Threads::RWLock::LockForWrite()
 {
-	/* Acquire exclusive lock.
-	 */
-	exclusiveAccessMutex->Lock();
-
-	/* Wait for read operations to finish.
-	 */
-	sharedAccessMutex->Lock();
-
-	while (readLocked)
-	{
-		sharedAccessMutex->Release();
-		exclusiveAccessMutex->Release();
-
-		S::System::System::Sleep(0);
-
-		exclusiveAccessMutex->Lock();
-		sharedAccessMutex->Lock();
-	}
-
-	/* Increase write lock counter.
-	 */
-	writeLocked++;
-
-	sharedAccessMutex->Release();
-
-	return True;
+	return backend->LockForWrite();
 }
 
 S::Bool S::Threads::RWLock::Release()
 {
-	/* Check if we are locked for write.
-	 */
-	sharedAccessMutex->Lock();
-
-	if (writeLocked && !readLocked)
-	{
-		/* Decrease write lock counter.
-		 */
-		writeLocked--;
-
-		sharedAccessMutex->Release();
-
-		/* Allow new read and write locks again.
-		 */
-		exclusiveAccessMutex->Release();
-
-		return True;
-	}
-
-	/* Decrease read lock counter by one.
-	 */
-	readLocked--;
-
-	sharedAccessMutex->Release();
-
-	return True;
+	return backend->Release();
 }
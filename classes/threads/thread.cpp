@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -100,7 +100,14 @@ S::Int S::Threads::Thread::Start()
 
 		status = THREAD_RUNNING;
 
-		backend->Start((Void (*)(Void *)) MainCaller, this);
+		if (backend->Start((Void (*)(Void *)) MainCaller, this) != Success())
+		{
+			status = THREAD_CREATED;
+
+			Access::Decrement(nOfRunningThreads);
+
+			return Error();
+		}
 
 		return Success();
 	}
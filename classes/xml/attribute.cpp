@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2009 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -10,16 +10,12 @@
 
 #include <smooth/xml/attribute.h>
 
-S::Array<S::String> S::XML::Attribute::attributeNames;
-
 S::XML::Attribute::Attribute(const String &iName, const String &iContent)
 {
 	attributeID	= -1;
 
-	nameIndex	= iName.ComputeCRC32();
+	name		= StringPool::GetGlobal().Intern(iName);
 	content		= iContent;
-
-	if (attributeNames.Get(nameIndex) == NIL) attributeNames.Add(iName, nameIndex);
 }
 
 S::XML::Attribute::~Attribute()
@@ -40,14 +36,12 @@ S::Int S::XML::Attribute::SetAttributeID(Int newID)
 
 const S::String &S::XML::Attribute::GetName() const
 {
-	return attributeNames.Get(nameIndex);
+	return *name;
 }
 
 S::Int S::XML::Attribute::SetName(const String &newName)
 {
-	nameIndex = newName.ComputeCRC32();
-
-	if (attributeNames.Get(nameIndex) == NIL) attributeNames.Add(newName, nameIndex);
+	name = StringPool::GetGlobal().Intern(newName);
 
 	return Success();
 }
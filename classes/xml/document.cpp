@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2020 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -57,7 +57,7 @@ S::Int S::XML::Document::LoadFile(const String &fileName)
 {
 	if (!File(fileName).Exists()) return Error();
 
-	xmlTextReaderPtr reader = xmlNewTextReaderFilename(fileName.ConvertTo("UTF-8"));
+	xmlTextReaderPtr reader = xmlNewTextReaderFilename(String::ConvertedString(fileName, "UTF-8"));
 
 	if (reader == NIL) return Error();
 
@@ -149,12 +149,18 @@ S::Int S::XML::Document::LoadNode(xmlTextReaderPtr reader, Node *node)
 
 S::Int S::XML::Document::SaveFile(const String &fileName)
 {
-	xmlTextWriterPtr	 writer = xmlNewTextWriterFilename(fileName.ConvertTo("UTF-8"), 0);
+	xmlTextWriterPtr	 writer = xmlNewTextWriterFilename(String::ConvertedString(fileName, "UTF-8"), 0);
 
 	xmlTextWriterSetIndent(writer, 1);
 	xmlTextWriterStartDocument(writer, "1.0", encoding, NIL);
 
-	if (rootNode != NIL) SaveNode(writer, rootNode);
+	/* Convert names and contents into buffers shared by all
+	 * nodes to avoid allocating temporary strings for each.
+	 */
+	Buffer<char>	 name;
+	Buffer<char>	 content;
+
+	if (rootNode != NIL) SaveNode(writer, rootNode, name, content);
 
 	xmlTextWriterEndDocument(writer);
 	xmlFreeTextWriter(writer);
@@ -162,15 +168,30 @@ S::Int S::XML::Document::SaveFile(const String &fileName)
 	return Success();
 }
 
-S::Int S::XML::Document::SaveNode(xmlTextWriterPtr writer, Node *node)
+S::Int S::XML::Document::SaveNode(xmlTextWriterPtr writer, Node *node, Buffer<char> &name, Buffer<char> &content)
 {
-	xmlTextWriterStartElement(writer, (xmlChar *) node->GetName().ConvertTo("UTF-8"));
+	node->GetName().ConvertTo("UTF-8", name);
+
+	xmlTextWriterStartElement(writer, (xmlChar *) (char *) name);
 
-	for (Int i = 0; i < node->GetNOfAttributes(); i++) xmlTextWriterWriteAttribute(writer, (xmlChar *) node->GetNthAttribute(i)->GetName().ConvertTo("UTF-8"), (xmlChar *) node->GetNthAttribute(i)->GetContent().ConvertTo("UTF-8"));
+	for (Int i = 0; i < node->GetNOfAttributes(); i++)
+	{
+		Attribute	*attribute = node->GetNthAttribute(i);
 
-	xmlTextWriterWriteString(writer, (xmlChar *) node->GetContent().ConvertTo("UTF-8"));
+		attribute->GetName().ConvertTo("UTF-8", name);
+		attribute->GetContent().ConvertTo("UTF-8", content);
+
+		xmlTextWriterWriteAttribute(writer, (xmlChar *) (char *) name, (xmlChar *) (char *) content);
+	}
+
+	if (node->GetContent() != NIL)
+	{
+		node->GetContent().ConvertTo("UTF-8", content);
+
+		xmlTextWriterWriteString(writer, (xmlChar *) (char *) content);
+	}
 
-	for (Int i = 0; i < node->GetNOfNodes(); i++) SaveNode(writer, node->GetNthNode(i));
+	for (Int i = 0; i < node->GetNOfNodes(); i++) SaveNode(writer, node->GetNthNode(i), name, content);
 
 	xmlTextWriterEndElement(writer);
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2022 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -11,26 +11,22 @@
 #include <smooth/xml/node.h>
 #include <smooth/foreach.h>
 
-S::Array<S::String> S::XML::Node::elementNames;
-
 S::XML::Node::Node(const String &iName, const String &iContent)
 {
 	nodeID		= -1;
 
-	nameIndex	= iName.ComputeCRC32();
+	name		= StringPool::GetGlobal().Intern(iName);
 	content		= iContent;
 
 	attributes	= NIL;
 	subnodes	= NIL;
-
-	if (elementNames.Get(nameIndex) == NIL) elementNames.Add(iName, nameIndex);
 }
 
 S::XML::Node::Node(const Node &oNode)
 {
 	nodeID		= -1;
 
-	nameIndex	= oNode.nameIndex;
+	name		= oNode.name;
 	content		= oNode.content;
 
 	attributes	= NIL;
@@ -100,14 +96,12 @@ S::Int S::XML::Node::SetNodeID(Int newID)
 
 const S::String &S::XML::Node::GetName() const
 {
-	return elementNames.Get(nameIndex);
+	return *name;
 }
 
 S::Int S::XML::Node::SetName(const String &newName)
 {
-	nameIndex = newName.ComputeCRC32();
-
-	if (elementNames.Get(nameIndex) == NIL) elementNames.Add(newName, nameIndex);
+	name = StringPool::GetGlobal().Intern(newName);
 
 	return Success();
 }
@@ -144,13 +138,17 @@ S::XML::Attribute *S::XML::Node::GetAttributeByName(const String &attributeName)
 
 	if (nOfAttributes == 0) return NIL;
 
-	Int	 nameIndex     = attributeName.ComputeCRC32();
+	/* Names not in the pool cannot be in use.
+	 */
+	const String	*pooledName = StringPool::GetGlobal().Find(attributeName);
+
+	if (pooledName == NIL) return NIL;
 
 	for (Int i = 0; i < nOfAttributes; i++)
 	{
 		Attribute	*attribute = GetNthAttribute(i);
 
-		if (attribute->nameIndex == nameIndex) return attribute;
+		if (attribute->name == pooledName) return attribute;
 	}
 
 	return NIL;
@@ -212,13 +210,15 @@ S::XML::Node *S::XML::Node::GetNodeByName(const String &nodeName) const
 
 	if (nOfNodes == 0) return NIL;
 
-	Int	 nameIndex = nodeName.ComputeCRC32();
+	const String	*pooledName = StringPool::GetGlobal().Find(nodeName);
+
+	if (pooledName == NIL) return NIL;
 
 	for (Int i = 0; i < nOfNodes; i++)
 	{
 		Node	*node = GetNthNode(i);
 
-		if (node->nameIndex == nameIndex) return node;
+		if (node->name == pooledName) return node;
 	}
 
 	return NIL;
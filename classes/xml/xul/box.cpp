@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2009 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -20,21 +20,30 @@
 
 S::XML::XUL::Box::Box(Node *node) : Widget(node)
 {
+	static const String	*box	     = StringPool::GetGlobal().Intern("box");
+	static const String	*hbox	     = StringPool::GetGlobal().Intern("hbox");
+	static const String	*vbox	     = StringPool::GetGlobal().Intern("vbox");
+	static const String	*button	     = StringPool::GetGlobal().Intern("button");
+	static const String	*textbox     = StringPool::GetGlobal().Intern("textbox");
+	static const String	*label	     = StringPool::GetGlobal().Intern("label");
+	static const String	*description = StringPool::GetGlobal().Intern("description");
+
 	layer = NIL;
 
 	if (node != NIL)
 	{
 		layer = new GUI::Layer();
 
-		if (node->GetName() == "hbox")		orient = HORIZONTAL;
-		else if (node->GetName() == "vbox")	orient = VERTICAL;
+		if	(node->GetPooledName() == hbox) orient = HORIZONTAL;
+		else if (node->GetPooledName() == vbox) orient = VERTICAL;
 
 		for (Int i = 0; i < node->GetNOfNodes(); i++)
 		{
 			Node		*nNode	= node->GetNthNode(i);
+			const String	*name	= nNode->GetPooledName();
 			XUL::Widget	*widget	= NIL;
 
-			if (nNode->GetName() == "box" || nNode->GetName() == "hbox" || nNode->GetName() == "vbox")
+			if (name == box || name == hbox || name == vbox)
 			{
 				widget = new XUL::Box(nNode);
 
@@ -42,7 +51,7 @@ S::XML::XUL::Box::Box(Node *node) : Widget(node)
 
 				widgets.Add(widget);
 			}
-			else if (nNode->GetName() == "button")
+			else if (name == button)
 			{
 				widget = new XUL::Button(nNode);
 
@@ -50,7 +59,7 @@ S::XML::XUL::Box::Box(Node *node) : Widget(node)
 
 				widgets.Add(widget);
 			}
-			else if (nNode->GetName() == "textbox")
+			else if (name == textbox)
 			{
 				widget = new XUL::TextBox(nNode);
 
@@ -58,7 +67,7 @@ S::XML::XUL::Box::Box(Node *node) : Widget(node)
 
 				widgets.Add(widget);
 			}
-			else if (nNode->GetName() == "label")
+			else if (name == label)
 			{
 				widget = new XUL::Label(nNode);
 
@@ -66,7 +75,7 @@ S::XML::XUL::Box::Box(Node *node) : Widget(node)
 
 				widgets.Add(widget);
 			}
-			else if (nNode->GetName() == "description")
+			else if (name == description)
 			{
 				widget = new XUL::Description(nNode);
 
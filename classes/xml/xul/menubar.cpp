@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2009 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -15,6 +15,9 @@
 
 S::XML::XUL::Menubar::Menubar(Node *node) : Widget(node)
 {
+	static const String	*menu	       = StringPool::GetGlobal().Intern("menu");
+	static const String	*toolbarbutton = StringPool::GetGlobal().Intern("toolbarbutton");
+
 	menubar = NIL;
 
 	if (node != NIL)
@@ -25,15 +28,15 @@ S::XML::XUL::Menubar::Menubar(Node *node) : Widget(node)
 		{
 			Node	*mNode = node->GetNthNode(i);
 
-			if (mNode->GetName() == "menu")
+			if (mNode->GetPooledName() == menu)
 			{
-				XUL::PopupMenu	*menu = new XUL::PopupMenu(mNode);
+				XUL::PopupMenu	*popup = new XUL::PopupMenu(mNode);
 
-				menubar->AddEntry(menu->GetName(), NIL, (GUI::PopupMenu *) menu->GetWidget());
+				menubar->AddEntry(popup->GetName(), NIL, (GUI::PopupMenu *) popup->GetWidget());
 
-				entries.Add(menu);
+				entries.Add(popup);
 			}
-			else if (mNode->GetName() == "toolbarbutton")
+			else if (mNode->GetPooledName() == toolbarbutton)
 			{
 				menubar->AddEntry(GetXMLAttributeValue(mNode, "label"));
 			}
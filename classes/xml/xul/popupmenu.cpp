@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2009 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -14,13 +14,18 @@
 
 S::XML::XUL::PopupMenu::PopupMenu(Node *node) : Widget(node)
 {
+	static const String	*menupopup     = StringPool::GetGlobal().Intern("menupopup");
+	static const String	*menuitem      = StringPool::GetGlobal().Intern("menuitem");
+	static const String	*menuseparator = StringPool::GetGlobal().Intern("menuseparator");
+	static const String	*submenu       = StringPool::GetGlobal().Intern("menu");
+
 	menu = NIL;
 
 	if (node != NIL)
 	{
 		name	= GetXMLAttributeValue(node, "label");
 
-		if (node->GetNthNode(0)->GetName() == "menupopup")
+		if (node->GetNthNode(0)->GetPooledName() == menupopup)
 		{
 			node = node->GetNthNode(0);
 
@@ -30,15 +35,15 @@ S::XML::XUL::PopupMenu::PopupMenu(Node *node) : Widget(node)
 			{
 				Node	*entry = node->GetNthNode(i);
 
-				if (entry->GetName() == "menuitem")
+				if (entry->GetPooledName() == menuitem)
 				{
 					menu->AddEntry(GetXMLAttributeValue(entry, "label"));
 				}
-				else if (entry->GetName() == "menuseparator")
+				else if (entry->GetPooledName() == menuseparator)
 				{
 					menu->AddEntry();
 				}
-				else if (entry->GetName() == "menu")
+				else if (entry->GetPooledName() == submenu)
 				{
 					XUL::PopupMenu	*popup = new XUL::PopupMenu(entry);
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2009 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -56,7 +56,9 @@ S::GUI::Widget *S::XML::XUL::Renderer::GetWidget() const
 
 S::Int S::XML::XUL::Renderer::RenderXUL(Document *xul)
 {
-	if (xul->GetRootNode()->GetName() == "window")
+	static const String	*windowName = StringPool::GetGlobal().Intern("window");
+
+	if (xul->GetRootNode()->GetPooledName() == windowName)
 	{
 		window = new XUL::Window(xul->GetRootNode());
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2013 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -79,13 +79,11 @@ S::Int S::XML::XUL::Widget::SetMetrics(const GUI::Point &pos, const GUI::Size &s
 
 S::String S::XML::XUL::Widget::GetXMLAttributeValue(Node *node, const String &attribute) const
 {
-	if (node != NIL)
-	{
-		if (node->GetAttributeByName(attribute) != NIL)
-		{
-			return node->GetAttributeByName(attribute)->GetContent();
-		}
-	}
+	if (node == NIL) return NIL;
+
+	Attribute	*xmlAttribute = node->GetAttributeByName(attribute);
+
+	if (xmlAttribute != NIL) return xmlAttribute->GetContent();
 
 	return NIL;
 }
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2009 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -17,6 +17,10 @@
 
 S::XML::XUL::Window::Window(Node *node) : Widget(node)
 {
+	static const String	*toolbox = StringPool::GetGlobal().Intern("toolbox");
+	static const String	*menubar = StringPool::GetGlobal().Intern("menubar");
+	static const String	*toolbar = StringPool::GetGlobal().Intern("toolbar");
+
 	titlebar	= NIL;
 	window		= NIL;
 
@@ -38,13 +42,13 @@ S::XML::XUL::Window::Window(Node *node) : Widget(node)
 		{
 			Node	*nNode = node->GetNthNode(i);
 
-			if (nNode->GetName() == "toolbox")
+			if (nNode->GetPooledName() == toolbox)
 			{
 				for (Int j = 0; j < nNode->GetNOfNodes(); j++)
 				{
 					Node	*tNode = nNode->GetNthNode(j);
 
-					if (tNode->GetName() == "menubar" || tNode->GetName() == "toolbar")
+					if (tNode->GetPooledName() == menubar || tNode->GetPooledName() == toolbar)
 					{
 						XUL::Menubar	*menu = new XUL::Menubar(tNode);
 
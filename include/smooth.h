@@ -19,6 +19,8 @@
 #include "smooth/version.h"
 
 #include "smooth/templates/array.h"
+#include "smooth/templates/hashmap.h"
+#include "smooth/templates/hashset.h"
 #include "smooth/templates/iterator.h"
 #include "smooth/templates/buffer.h"
 #include "smooth/templates/nonblocking.h"
@@ -73,6 +75,7 @@
 #include "smooth/threads/semaphore.h"
 #include "smooth/threads/thread.h"
 #include "smooth/threads/access.h"
+#include "smooth/threads/atomic.h"
 
 #include "smooth/graphics/forms/line.h"
 #include "smooth/graphics/forms/point.h"
@@ -92,11 +95,13 @@
 #include "smooth/misc/encoding/base64.h"
 #include "smooth/misc/encoding/urlencode.h"
 
+#include "smooth/misc/hash/blake3.h"
 #include "smooth/misc/hash/crc16.h"
 #include "smooth/misc/hash/crc32.h"
 #include "smooth/misc/hash/crc64.h"
 #include "smooth/misc/hash/md5.h"
 #include "smooth/misc/hash/sha1.h"
+#include "smooth/misc/hash/wyhash.h"
 
 #include "smooth/misc/binary.h"
 #include "smooth/misc/config.h"
@@ -105,6 +110,9 @@
 #include "smooth/misc/memory.h"
 #include "smooth/misc/number.h"
 #include "smooth/misc/string.h"
+#include "smooth/misc/stringbuilder.h"
+#include "smooth/misc/stringpool.h"
+#include "smooth/misc/stringview.h"
 
 #include "smooth/gui/application/application.h"
 
@@ -94,7 +94,7 @@ namespace smooth
 			const ObjectType		&GetObjectType() const			{ return type; }
 			virtual inline Bool		 IsTypeCompatible(Short objType) const	{ return (objType == classID); }
 
-			Bool				 IsObjectInUse() const			{ return isObjectInUse > 0; }
+			Bool				 IsObjectInUse() const			{ return Threads::Access::Value(isObjectInUse) > 0; }
 		slots:
 			static Void			 ObjectCleanup();
 	};
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2020 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -17,6 +17,13 @@
 #	endif
 #endif
 
+/* Enable move constructors and move assignment
+ * when compiling in C++11 mode or newer.
+ */
+#if __cplusplus >= 201103L || (defined _MSC_VER && _MSC_VER >= 1800)
+#	define SMOOTH_HAS_MOVE_SEMANTICS
+#endif
+
 #if defined _WIN32 || defined __WIN32__
 #	include "definitions.win32.h"
 #else
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2010 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -12,6 +12,7 @@
 #define H_OBJSMOOTH_I18N_SECTION
 
 #include "../misc/string.h"
+#include "../templates/hashmap.h"
 #include "../xml/document.h"
 
 namespace smooth
@@ -26,8 +27,8 @@ namespace smooth
 				String				 context;
 				Section				*contextSection;
 			public:
-				Array<String>			 strings;
-				Array<Section *, Void *>	 sections;
+				HashMap<String, String>		 strings;
+				HashMap<String, Section *>	 sections;
 
 								 Section();
 				virtual				~Section();
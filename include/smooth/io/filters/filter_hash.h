@@ -0,0 +1,68 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_FILTER_HASH
+#define H_OBJSMOOTH_FILTER_HASH
+
+namespace smooth
+{
+	namespace IO
+	{
+		template <class t> class FilterHash;
+	};
+};
+
+#include "../../definitions.h"
+#include "../filter.h"
+
+namespace smooth
+{
+	namespace IO
+	{
+		/* Pass-through filter feeding all data read or written to a
+		 * hash object like Hash::CRC32, Hash::MD5 or Hash::SHA1.
+		 *
+		 * Packages are hashed in place in the order they pass the filter,
+		 * so seeking a filtered stream invalidates the result. Note that
+		 * InStream reads ahead whole packages. Call the hash object's
+		 * Finish method after closing the stream to get the digest.
+		 */
+		template <class t> class FilterHash : public Filter
+		{
+			private:
+				t		&hash;
+			public:
+						 FilterHash(t &iHash) : hash(iHash)	{ }
+						~FilterHash()				{ }
+
+				Int		 WriteData(const Buffer<UnsignedByte> &data)
+				{
+					Int	 bytes = Filter::WriteData(data);
+
+					if (bytes > 0) hash.Feed(data, bytes);
+
+					return bytes;
+				}
+
+				Int		 ReadData(Buffer<UnsignedByte> &data)
+				{
+					Int	 bytes = Filter::ReadData(data);
+
+					if (bytes > 0) hash.Feed(data, bytes);
+
+					return bytes;
+				}
+
+				t		&GetHash() const			{ return hash; }
+		};
+	};
+};
+
+#endif
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2019 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -16,6 +16,7 @@ namespace smooth
 	namespace IO
 	{
 		class InStream;
+		class InputLines;
 		class OutStream;
 		class Driver;
 		class Filter;
@@ -26,6 +27,7 @@ namespace smooth
 
 #include "../definitions.h"
 #include "stream.h"
+#include "../misc/stringview.h"
 
 #define InputNumberIntel InputNumber
 
@@ -45,10 +47,18 @@ namespace smooth
 
 				OutStream	*outStream;
 
+				Buffer<char>	 lineBuffer;
+
 				Bool		 InitBitstream		();
 				Bool		 CompleteBitstream	();
 
+				Void		 RefillBits		(Int);
+
 				Bool		 ReadData		();
+				Int		 ReadLine		();
+
+				template <class t, Bool bigEndian> t	 InputValue	();
+				template <class t, Bool bigEndian> Int	 InputValues	(Buffer<t> &, Int);
 			public:
 						 InStream		(Int, Driver *);
 						 InStream		(Int, const String &, Int = IS_READ);
@@ -61,12 +71,34 @@ namespace smooth
 				Int64		 InputNumberRaw		(Int);
 
 				Int64		 InputBits		(Int);
+				Int64		 PeekBits		(Int);
+				Bool		 SkipBits		(Int64);
+
+				Int64		 InputUnary		();
+				Int64		 InputExpGolomb		();
+				Int64		 InputSignedExpGolomb	();
+
+				UnsignedInt16	 ReadU16LE		();
+				UnsignedInt16	 ReadU16BE		();
+				UnsignedInt32	 ReadU32LE		();
+				UnsignedInt32	 ReadU32BE		();
+				UnsignedInt64	 ReadU64LE		();
+				UnsignedInt64	 ReadU64BE		();
+
+				Int		 ReadU16LE		(Buffer<UnsignedInt16> &, Int);
+				Int		 ReadU16BE		(Buffer<UnsignedInt16> &, Int);
+				Int		 ReadU32LE		(Buffer<UnsignedInt32> &, Int);
+				Int		 ReadU32BE		(Buffer<UnsignedInt32> &, Int);
+				Int		 ReadU64LE		(Buffer<UnsignedInt64> &, Int);
+				Int		 ReadU64BE		(Buffer<UnsignedInt64> &, Int);
 
 				String		 InputString		(Int);
 				String		 InputLine		();
+				Bool		 InputLine		(String &);
 				Int		 InputData		(Void *, Int);
 
 				Bool		 SetPackageSize		(Int);
+				Bool		 SetBitOrder		(Short);
 
 				Bool		 SetFilter		(Filter *);
 				Bool		 RemoveFilter		();
@@ -76,6 +108,22 @@ namespace smooth
 				Bool		 Seek			(Int64);
 				Bool		 RelSeek		(Int64);
 		};
+
+		/* Iterates over the lines of a stream reusing a single string,
+		 * so reading lines does not allocate once it is large enough.
+		 *
+		 * Views returned by Next become invalid on the next call.
+		 */
+		class InputLines
+		{
+			private:
+				InStream	&stream;
+				String		 line;
+			public:
+						 InputLines(InStream &iStream) : stream(iStream)	{ }
+
+				Bool		 Next(StringView &view)				{ if (!stream.InputLine(line)) return False; view = line; return True; }
+		};
 	};
 };
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2020 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -34,6 +34,9 @@ namespace smooth
 		const Short	 IO_ERROR_WRONGOS	= 7;	// the requested functionality is not available under the current operating system
 		const Short	 IO_ERROR_NODATA	= 8;	// no data is available in the queue
 		const Short	 IO_ERROR_NOACCESS	= 9;	// access to the requested resource has been denied
+
+		const Short	 BITS_LSB_FIRST		= 0;	// read and write the least significant bit of each byte first
+		const Short	 BITS_MSB_FIRST		= 1;	// read and write the most significant bit of each byte first
 	};
 };
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2019 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -48,7 +48,11 @@ namespace smooth
 				Bool		 InitBitstream		();
 				Bool		 CompleteBitstream	();
 
+				Bool		 FlushBits		();
+
 				Bool		 WriteData		();
+
+				template <class t, Bool bigEndian> Bool	 OutputValue	(t);
 			public:
 						 OutStream		(Int, Driver *);
 						 OutStream		(Int, const String &, Int = OS_APPEND);
@@ -62,11 +66,23 @@ namespace smooth
 
 				Bool		 OutputBits		(Int64, Int);
 
+				Bool		 OutputUnary		(Int64);
+				Bool		 OutputExpGolomb	(Int64);
+				Bool		 OutputSignedExpGolomb	(Int64);
+
+				Bool		 WriteU16LE		(UnsignedInt16);
+				Bool		 WriteU16BE		(UnsignedInt16);
+				Bool		 WriteU32LE		(UnsignedInt32);
+				Bool		 WriteU32BE		(UnsignedInt32);
+				Bool		 WriteU64LE		(UnsignedInt64);
+				Bool		 WriteU64BE		(UnsignedInt64);
+
 				Bool		 OutputString		(const String &);
 				Bool		 OutputLine		(const String & = NIL);
 				Bool		 OutputData		(const Void *, Int);
 
 				Bool		 SetPackageSize		(Int);
+				Bool		 SetBitOrder		(Short);
 
 				Bool		 SetFilter		(Filter *);
 				Bool		 RemoveFilter		();
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2019 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -52,8 +52,10 @@ namespace smooth
 
 				Bool			 bitstreamActive;
 				Bool			 keepBits;
+				Short			 bitOrder;
+
+				UnsignedInt64		 bitBuffer;
 				Int			 bitLength;
-				Bool			 bitBuffer[128];
 
 				Driver			*driver;
 				Filter			*filter;
@@ -74,8 +76,10 @@ namespace smooth
 				Short			 GetStreamType() const	{ return streamType; }
 				Short			 GetLastError() const	{ return lastError; }
 
+				Short			 GetBitOrder() const	{ return bitOrder; }
+
 				Int64			 Size() const		{ if (streamType == STREAM_NONE) { lastError = IO_ERROR_NOTOPEN; return -1; } return size; }
-				Int64			 GetPos() const		{ if (streamType == STREAM_NONE) { lastError = IO_ERROR_NOTOPEN; return -1; } return currentFilePos; }
+				Int64			 GetPos() const		{ if (streamType == STREAM_NONE) { lastError = IO_ERROR_NOTOPEN; return -1; } return currentFilePos - bitLength / 8; }
 		};
 	};
 };
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2020 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -35,11 +35,29 @@ namespace smooth
 
 			Buffer<Int>		 indices;
 
+			Int			 hashSize;
+			Buffer<Int>		 hashTable;
+
 			mutable Bool		 lockingEnabled;
 			mutable Threads::RWLock	*lock;
 
 			Bool			 IndexAvailable(Int) const;
 			Int			 GetEntryNumberByIndex(Int) const;
+
+			/* Hash index for unsorted arrays.
+			 */
+			Void			 HashRebuild();
+			Void			 HashFree();
+
+			Void			 HashInsert(Int, Int);
+			Void			 HashRemove(Int);
+			Void			 HashUpdate(Int, Int);
+
+			Int			 HashFind(Int) const;
+
+			/* Exchange index state with another array.
+			 */
+			Void			 Swap(IndexArray &);
 		public:
 						 IndexArray();
 			virtual			~IndexArray();
@@ -67,6 +85,12 @@ namespace smooth
 
 			inline Void		 Unlock() const		{ if (lockingEnabled) lock->Release(); }
 
+			/* Number of times threads had to wait for the lock
+			 * to find out which arrays are highly contended.
+			 */
+			inline Int		 GetReadContention() const	{ return lock != NIL ? lock->GetReadContention() : 0; }
+			inline Int		 GetWriteContention() const	{ return lock != NIL ? lock->GetWriteContention() : 0; }
+
 			/* Simple scoped lockers for arrays.
 			 */
 			class ReadLock
@@ -1,43 +1,94 @@
- /* The smooth Class Library
-  * Copyright (C) 1998-2009 Robert Kausch <robert.kausch@gmx.net>
-  *
-  * This library is free software; you can redistribute it and/or
-  * modify it under the terms of "The Artistic License, Version 2.0".
-  *
-  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
-  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
-  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
-
-#ifndef H_OBJSMOOTH_BASE64
-#define H_OBJSMOOTH_BASE64
-
-namespace smooth
-{
-	namespace Encoding
-	{
-		class Base64;
-	};
-};
-
-#include "../string.h"
-#include "../../templates/buffer.h"
-
-namespace smooth
-{
-	namespace Encoding
-	{
-		class SMOOTHAPI Base64
-		{
-			private:
-				Buffer<UnsignedByte>	&buffer;
-			public:
-							 Base64(Buffer<UnsignedByte> &);
-							~Base64();
-
-				String			 Encode(Int = -1) const;
-				Int			 Decode(const String &);
-		};
-	};
-};
-
-#endif
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_BASE64
+#define H_OBJSMOOTH_BASE64
+
+namespace smooth
+{
+	namespace Encoding
+	{
+		class Base64;
+
+		class Base64Encoder;
+		class Base64Decoder;
+	};
+};
+
+#include "../string.h"
+#include "../../templates/buffer.h"
+
+namespace smooth
+{
+	namespace Encoding
+	{
+		class SMOOTHAPI Base64
+		{
+			private:
+				Buffer<UnsignedByte>	&buffer;
+			public:
+							 Base64(Buffer<UnsignedByte> &);
+							~Base64();
+
+				String			 Encode(Int = -1) const;
+				Int			 Decode(const String &);
+		};
+
+		/* Incremental Base64 encoder.
+		 *
+		 * Feed and Finish resize the output buffer to the number of
+		 * characters written by the call and return that number.
+		 */
+		class SMOOTHAPI Base64Encoder
+		{
+			private:
+				UnsignedByte		 pending[3];
+				Int			 numPending;
+			public:
+							 Base64Encoder();
+							~Base64Encoder();
+
+				Bool			 Reset();
+
+				Int			 Feed(const UnsignedByte *, Int, Buffer<char> &);
+				Int			 Feed(const Buffer<UnsignedByte> &, Buffer<char> &);
+
+				Int			 Finish(Buffer<char> &);
+		};
+
+		/* Incremental Base64 decoder.
+		 *
+		 * Whitespace is skipped and padding is optional. Feed and Finish
+		 * resize the output buffer to the number of bytes written by the
+		 * call and return that number or -1 if the input is invalid.
+		 */
+		class SMOOTHAPI Base64Decoder
+		{
+			private:
+				UnsignedByte		 pending[4];
+				Int			 numPending;
+
+				Bool			 padded;
+				Bool			 failed;
+			public:
+							 Base64Decoder();
+							~Base64Decoder();
+
+				Bool			 Reset();
+
+				Int			 Feed(const char *, Int, Buffer<UnsignedByte> &);
+				Int			 Feed(const Buffer<char> &, Buffer<UnsignedByte> &);
+
+				Int			 Finish(Buffer<UnsignedByte> &);
+		};
+	};
+};
+
+#endif
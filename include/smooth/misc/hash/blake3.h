@@ -0,0 +1,76 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_BLAKE3
+#define H_OBJSMOOTH_BLAKE3
+
+namespace smooth
+{
+	namespace Hash
+	{
+		class BLAKE3;
+	};
+};
+
+#include "../string.h"
+#include "../../files/file.h"
+#include "../../templates/buffer.h"
+
+namespace smooth
+{
+	namespace Hash
+	{
+		/* BLAKE3 tree hash.
+		 *
+		 * Input is split into 1 kB chunks forming the leaves of a binary
+		 * tree. Large inputs are hashed several chunks at a time using
+		 * SIMD lanes and split into subtrees hashed on a pool of threads.
+		 */
+		class SMOOTHAPI BLAKE3
+		{
+			constants:
+				static const Int	 DigestSize = 32;
+			private:
+				UnsignedByte		 stack[54 * 32];
+				Int			 stackDepth;
+
+				UnsignedInt32		 chunkState[8];
+				UnsignedInt64		 chunkCounter;
+
+				UnsignedByte		 block[64];
+				Int			 blockLength;
+				Int			 blocksCompressed;
+
+				Void			 ChunkFeed(const UnsignedByte *, Int);
+				Void			 ChunkFinish(UnsignedByte *) const;
+
+				Void			 MergeStack(UnsignedInt64);
+				Void			 PushStack(const UnsignedByte *, UnsignedInt64);
+			public:
+				static String		 Compute(const UnsignedByte *, Int);
+				static String		 Compute(const Buffer<UnsignedByte> &);
+
+				static String		 ComputeFile(const File &);
+
+							 BLAKE3();
+							~BLAKE3();
+
+				Bool			 Reset();
+
+				Bool			 Feed(const UnsignedByte *, Int);
+				Bool			 Feed(const Buffer<UnsignedByte> &);
+
+				String			 Finish();
+				Bool			 Finish(UnsignedByte *);
+		};
+	};
+};
+
+#endif
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2018 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -30,16 +30,29 @@ namespace smooth
 		{
 			private:
 				static UnsignedInt32	 table[8][256];
+				static UnsignedInt32	 powers[64];
+				static UnsignedInt64	 fold[4];
+
 				static Bool		 initialized;
 
 				UnsignedInt32		 crc;
 
 				static Bool		 InitTable();
+
+				static UnsignedInt32	 Multiply(UnsignedInt32, UnsignedInt32);
+				static UnsignedInt32	 XPowN(UnsignedInt64);
+
+				Void			 FeedTables(const UnsignedByte *, Int);
 				static UnsignedInt32	 Reflect(UnsignedInt32, char);
 			public:
 				static UnsignedInt32	 Compute(const UnsignedByte *, Int);
 				static UnsignedInt32	 Compute(const Buffer<UnsignedByte> &);
 
+				/* Compute the CRC of two concatenated blocks
+				 * from their CRCs and the size of the second.
+				 */
+				static UnsignedInt32	 Combine(UnsignedInt32, UnsignedInt32, Int64);
+
 							 CRC32();
 							~CRC32();
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2018 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -30,15 +30,28 @@ namespace smooth
 		{
 			private:
 				static UnsignedInt64	 table[8][256];
+				static UnsignedInt64	 powers[64];
+				static UnsignedInt64	 fold[4];
+
 				static Bool		 initialized;
 
 				UnsignedInt64		 crc;
 
 				static Bool		 InitTable();
+
+				static UnsignedInt64	 Multiply(UnsignedInt64, UnsignedInt64);
+				static UnsignedInt64	 XPowN(UnsignedInt64);
+
+				Void			 FeedTables(const UnsignedByte *, Int);
 			public:
 				static UnsignedInt64	 Compute(const UnsignedByte *, Int);
 				static UnsignedInt64	 Compute(const Buffer<UnsignedByte> &);
 
+				/* Compute the CRC of two concatenated blocks
+				 * from their CRCs and the size of the second.
+				 */
+				static UnsignedInt64	 Combine(UnsignedInt64, UnsignedInt64, Int64);
+
 							 CRC64();
 							~CRC64();
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2018 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -31,17 +31,26 @@ namespace smooth
 	{
 		class SMOOTHAPI MD5
 		{
+			constants:
+				static const Int	 DigestSize = 16;
 			private:
 				UnsignedInt32		 state[4];
 
 				UnsignedInt64		 size;
 				Buffer<UnsignedByte>	 buffer;
 
-				Void			 Transform(UnsignedByte *);
+				static Void		 Transform(UnsignedInt32 *, const UnsignedByte *);
+
+				Void			 ProcessBlocks(const UnsignedByte *, Int);
 			public:
 				static String		 Compute(const UnsignedByte *, Int);
 				static String		 Compute(const Buffer<UnsignedByte> &);
 
+				/* Compute the digests of several independent messages
+				 * at once, writing DigestSize bytes per message.
+				 */
+				static Bool		 Compute(const UnsignedByte * const *, const Int *, Int, UnsignedByte *);
+
 							 MD5();
 							~MD5();
 
@@ -51,6 +60,7 @@ namespace smooth
 				Bool			 Feed(const Buffer<UnsignedByte> &);
 
 				String			 Finish();
+				Bool			 Finish(UnsignedByte *);
 		};
 	};
 };
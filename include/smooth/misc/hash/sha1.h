@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2018 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -28,17 +28,26 @@ namespace smooth
 	{
 		class SMOOTHAPI SHA1
 		{
+			constants:
+				static const Int	 DigestSize = 20;
 			private:
 				UnsignedInt32		 state[5];
 
 				UnsignedInt64		 size;
 				Buffer<UnsignedByte>	 buffer;
 
-				Void			 Transform(UnsignedByte *);
+				static Void		 Transform(UnsignedInt32 *, const UnsignedByte *);
+
+				Void			 ProcessBlocks(const UnsignedByte *, Int);
 			public:
 				static String		 Compute(const UnsignedByte *, Int);
 				static String		 Compute(const Buffer<UnsignedByte> &);
 
+				/* Compute the digests of several independent messages
+				 * at once, writing DigestSize bytes per message.
+				 */
+				static Bool		 Compute(const UnsignedByte * const *, const Int *, Int, UnsignedByte *);
+
 							 SHA1();
 							~SHA1();
 
@@ -48,6 +57,7 @@ namespace smooth
 				Bool			 Feed(const Buffer<UnsignedByte> &);
 
 				String			 Finish();
+				Bool			 Finish(UnsignedByte *);
 		};
 	};
 };
@@ -0,0 +1,90 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_WYHASH
+#define H_OBJSMOOTH_WYHASH
+
+namespace smooth
+{
+	namespace Hash
+	{
+		class WyHash;
+	};
+};
+
+#include "../../definitions.h"
+#include "../../templates/buffer.h"
+
+#if defined _MSC_VER && defined _M_X64
+#	include <intrin.h>
+#endif
+
+namespace smooth
+{
+	namespace Hash
+	{
+		/* Fast seeded 64 bit hash for use in hash tables.
+		 *
+		 * This is the final version of wyhash by Wang Yi. It is
+		 * not suitable for cryptographic purposes or for values
+		 * that are stored or exchanged between systems.
+		 */
+		class SMOOTHAPI WyHash
+		{
+			private:
+				static const UnsignedInt64	 secret[4];
+
+				static UnsignedInt64		 InitSeed();
+			public:
+				static UnsignedInt64		 Compute(const UnsignedByte *, Int, UnsignedInt64 = 0);
+				static UnsignedInt64		 Compute(const Buffer<UnsignedByte> &, UnsignedInt64 = 0);
+
+				/* Hash a single 64 bit value.
+				 */
+				static UnsignedInt64		 ComputeValue(UnsignedInt64 value, UnsignedInt64 seed)	{ return Mix(value ^ secret[0], seed ^ secret[1]); }
+
+				/* Seed chosen randomly on first use for hash
+				 * tables that may store untrusted keys.
+				 */
+				static UnsignedInt64		 GetRandomSeed();
+
+				/* Multiply two values to 128 bits and
+				 * combine the upper and lower halves.
+				 */
+				static inline UnsignedInt64 Mix(UnsignedInt64 a, UnsignedInt64 b)
+				{
+#if defined __SIZEOF_INT128__
+					unsigned __int128	 r = (unsigned __int128) a * b;
+
+					return (UnsignedInt64) r ^ (UnsignedInt64) (r >> 64);
+#elif defined _MSC_VER && defined _M_X64
+					UnsignedInt64	 high = 0;
+					UnsignedInt64	 low  = _umul128(a, b, &high);
+
+					return low ^ high;
+#else
+					UnsignedInt64	 ha = a >> 32, la = (UnsignedInt32) a;
+					UnsignedInt64	 hb = b >> 32, lb = (UnsignedInt32) b;
+
+					UnsignedInt64	 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+					UnsignedInt64	 t  = rl + (rm0 << 32);
+					UnsignedInt64	 c  = t < rl;
+					UnsignedInt64	 lo = t + (rm1 << 32);
+
+					c += lo < t;
+
+					return lo ^ (rh + (rm0 >> 32) + (rm1 >> 32) + c);
+#endif
+				}
+		};
+	};
+};
+
+#endif
@@ -0,0 +1,105 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth/definitions.h>
+
+#ifndef H_OBJSMOOTH_HASH_INDEX
+#define H_OBJSMOOTH_HASH_INDEX
+
+namespace smooth
+{
+	class HashIndex;
+};
+
+#include <smooth/templates/buffer.h>
+#include <smooth/threads/rwlock.h>
+
+namespace smooth
+{
+	/* Open addressing index for hash maps and sets.
+	 *
+	 * Entries are stored densely in insertion order; removing an
+	 * entry moves the last entry into its place. The slot table
+	 * maps hash values to entry numbers using linear probing.
+	 */
+	class SMOOTHAPI HashIndex
+	{
+		protected:
+			Int			 nOfEntries;
+
+			UnsignedInt64		 seed;
+			Buffer<UnsignedInt64>	 hashes;
+
+			Int			 tableMask;
+			Buffer<Int>		 table;
+
+			mutable Bool		 lockingEnabled;
+			mutable Threads::RWLock	*lock;
+
+			/* Return the slot referring to an entry.
+			 */
+			Int			 GetSlotByEntry(Int) const;
+
+			Void			 Rebuild(Int);
+
+			/* Add an entry with the given hash at the end and
+			 * remove an entry, moving the last one into its place.
+			 */
+			Int			 InsertEntry(UnsignedInt64);
+			Void			 RemoveEntry(Int);
+
+			/* Exchange index state with another index.
+			 */
+			Void			 Swap(HashIndex &);
+		public:
+						 HashIndex();
+			virtual			~HashIndex();
+
+			virtual Bool		 RemoveAll();
+
+			inline Int		 Length() const		{ return nOfEntries; }
+
+			/* Locking and unlocking for synchronization.
+			 *
+			 * Lookups do not modify the index, so any number of
+			 * threads may read a map or set that is no longer
+			 * modified without enabling locking.
+			 */
+			Bool			 EnableLocking() const;
+			Bool			 DisableLocking() const;
+
+			inline Void		 LockForRead() const	{ if (lockingEnabled) lock->LockForRead(); }
+			inline Void		 LockForWrite() const	{ if (lockingEnabled) lock->LockForWrite(); }
+
+			inline Void		 Unlock() const		{ if (lockingEnabled) lock->Release(); }
+
+			/* Simple scoped lockers for maps and sets.
+			 */
+			class ReadLock
+			{
+				private:
+					const HashIndex		&index;
+				public:
+								 ReadLock(const HashIndex &i) : index(i) { index.LockForRead(); }
+								~ReadLock() { index.Unlock(); }
+			};
+
+			class WriteLock
+			{
+				private:
+					HashIndex		&index;
+				public:
+								 WriteLock(HashIndex &i) : index(i) { index.LockForWrite(); }
+								~WriteLock() { index.Unlock(); }
+			};
+	};
+};
+
+#endif
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2020 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -14,6 +14,8 @@
 namespace smooth
 {
 	class String;
+	class StringBuilder;
+	class StringView;
 
 	namespace Threads
 	{
@@ -29,9 +31,27 @@ namespace smooth
 	class SMOOTHAPI String
 	{
 		friend class Threads::Thread;
+		friend class StringBuilder;
+		friend class StringView;
 
 		private:
-			Buffer<wchar_t>		 wString;
+			/* Short strings are stored inline without allocating
+			 * any heap memory.
+			 */
+			SmallBuffer<wchar_t, 32 / sizeof(wchar_t)> wString;
+
+			/* Cached length or -1 if unknown.
+			 *
+			 * Writable access via operator [] keeps the cache, but
+			 * notes the lowest index handed out. Length() checks the
+			 * characters there the next time it is called. The index
+			 * is -1 if there are no pending writes and is stored as
+			 * -2 - index if more than one write is pending.
+			 */
+			mutable Int		 stringLength;
+			mutable Int		 writeIndex;
+
+			Void			 Reserve(Int);
 
 			static Void		 AddTemporaryBuffer(char *);
 			static Void		 DeleteTemporaryBuffers(Bool = False);
@@ -39,6 +59,8 @@ namespace smooth
 			class InputFormat;
 			class OutputFormat;
 
+			class ConvertedString;
+
 			static Int		 Initialize();
 			static Int		 Free();
 
@@ -47,6 +69,10 @@ namespace smooth
 						 String(const wchar_t *);
 						 String(const String &);
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+						 String(String &&);
+#endif
+
 						~String();
 
 			Void			 Clean();
@@ -67,13 +93,25 @@ namespace smooth
 			Int			 ImportFrom(const char *, const char *);
 			char			*ConvertTo(const char *) const;
 
+			/* Convert into a caller provided buffer, returning the
+			 * number of bytes needed including the terminating zero.
+			 * Nothing is converted if the buffer is too small.
+			 */
+			Int			 ConvertTo(const char *, char *, Int) const;
+			Int			 ConvertTo(const char *, Buffer<char> &) const;
+
 			UnsignedInt32		 ComputeCRC32() const;
 			UnsignedInt64		 ComputeCRC64() const;
 
+			/* Fast seeded hash for use in hash tables.
+			 */
+			UnsignedInt64		 ComputeHash(UnsignedInt64 = 0) const;
+
 			String			 EncodeBase64() const;
 			String			 DecodeBase64() const;
 
 			Int			 Find(const String &) const;
+			Int			 Find(const StringView &) const;
 			Int			 FindLast(const String &) const;
 
 			String			&Append(const String &);
@@ -82,15 +120,23 @@ namespace smooth
 			String			&Replace(const String &, const String &);
 			String			 Replace(const String &, const String &) const;
 
+			/* Replace patterns with the replacement at the same
+			 * index in a single pass over the string.
+			 */
+			String			&Replace(const Array<String> &, const Array<String> &);
+			String			 Replace(const Array<String> &, const Array<String> &) const;
+
 			String			&Copy(const String &);
 			String			&CopyN(const String &, const Int);
 
 			Bool			 Contains(const String &) const;
 
 			Int			 Compare(const String &) const;
+			Int			 Compare(const StringView &) const;
 			Int			 CompareN(const String &, const Int) const;
 
 			Bool			 StartsWith(const String &) const;
+			Bool			 StartsWith(const StringView &) const;
 			Bool			 EndsWith(const String &) const;
 
 			String			 SubString(Int, Int) const;
@@ -118,6 +164,16 @@ namespace smooth
 			String			 ToUpper() const;
 			String			 ToTitle() const;
 
+			/* Comparisons using simple case folding
+			 * without creating temporary strings.
+			 */
+			Int			 CompareIgnoreCase(const String &) const;
+
+			Int			 FindIgnoreCase(const String &) const;
+			Bool			 ContainsIgnoreCase(const String &) const;
+
+			UnsignedInt64		 HashIgnoreCase(UnsignedInt64 = 0) const;
+
 			Array<String>		 Explode(const String &) const;
 			static String		 Implode(const Array<String> &, const String & = String());
 
@@ -132,6 +188,10 @@ namespace smooth
 			String &operator	 =(const wchar_t *);
 			String &operator	 =(const String &);
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			String &operator	 =(String &&);
+#endif
+
 			Bool operator		 ==(const int) const;
 			Bool operator		 ==(const char *) const;
 			Bool operator		 ==(const wchar_t *) const;
@@ -162,6 +222,23 @@ namespace smooth
 				 OutputFormat(const char *outputFormat)	{ previousFormat.ImportFrom(GetDefaultEncoding(), SetOutputFormat(outputFormat)); }
 				~OutputFormat()				{ SetOutputFormat(previousFormat.ConvertTo(GetDefaultEncoding())); }
 	};
+
+	/* Scoped conversion keeping short results on the stack instead
+	 * of allocating a temporary buffer. Like ConvertTo, it converts
+	 * to the output format by default and yields NIL for empty strings.
+	 */
+	class SMOOTHAPI String::ConvertedString
+	{
+		private:
+			SmallBuffer<char, 256>	 buffer;
+
+				 ConvertedString(const ConvertedString &);
+			ConvertedString &operator =(const ConvertedString &);
+		public:
+				 ConvertedString(const String &, const char * = NIL);
+
+			operator char *() const					{ return buffer; }
+	};
 };
 
 #endif
@@ -0,0 +1,80 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_STRINGBUILDER
+#define H_OBJSMOOTH_STRINGBUILDER
+
+namespace smooth
+{
+	class StringBuilder;
+};
+
+#include "string.h"
+
+namespace smooth
+{
+	/* Builds strings from many small pieces.
+	 *
+	 * In linear mode, text is appended to a single geometrically
+	 * growing buffer that is handed over to the resulting string
+	 * by Finish without copying. In chunked mode, text is stored
+	 * in fixed size chunks that are never reallocated and joined
+	 * only once by Finish. Use it for very large outputs.
+	 */
+	class SMOOTHAPI StringBuilder
+	{
+		private:
+			static const Int	 ChunkSize = 65536;
+
+			String			 string;
+			Int			 length;
+
+			Bool			 chunked;
+
+			Array<wchar_t *>	 chunks;
+			Int			 chunkFill;
+
+			wchar_t			*Extend(Int, Int &);
+			Void			 Commit(Int);
+
+			Void			 AppendChars(const wchar_t *, Int);
+			Void			 AppendInteger(UnsignedInt64, Bool);
+
+			Void			 FreeChunks();
+
+			/* String builders are not copyable.
+			 */
+						 StringBuilder(const StringBuilder &);
+			StringBuilder &operator	 =(const StringBuilder &);
+		public:
+						 StringBuilder(Int = 0, Bool = False);
+						~StringBuilder();
+
+			Void			 Reserve(Int);
+
+			Int			 Length() const		{ return length; }
+
+			StringBuilder		&Append(const String &);
+			StringBuilder		&Append(const char *);
+			StringBuilder		&Append(const wchar_t *);
+
+			StringBuilder		&AppendChar(wchar_t);
+
+			StringBuilder		&Append(Int);
+			StringBuilder		&Append(Int64);
+			StringBuilder		&Append(Float);
+
+			/* Return the built string and reset the builder.
+			 */
+			String			 Finish();
+	};
+};
+
+#endif
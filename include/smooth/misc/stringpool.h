@@ -0,0 +1,72 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_STRINGPOOL
+#define H_OBJSMOOTH_STRINGPOOL
+
+namespace smooth
+{
+	class StringPool;
+	class StringPoolTable;
+};
+
+#include "string.h"
+#include "../threads/mutex.h"
+
+namespace smooth
+{
+	/* Thread safe pool of interned strings.
+	 *
+	 * Interning a string returns a pointer that stays valid for
+	 * the lifetime of the pool and is the same for all equal
+	 * strings, so interned strings can be compared by pointer.
+	 *
+	 * Looking up strings that are already in the pool does not
+	 * take any locks. Strings are never removed from a pool.
+	 */
+	class SMOOTHAPI StringPool
+	{
+		private:
+			StringPoolTable * volatile	 table;
+			Int			 nOfStrings;
+
+			Threads::Mutex		 mutex;
+
+			UnsignedInt64		 seed;
+
+			const String		*Lookup(const StringPoolTable *, const String &, UnsignedInt64) const;
+
+			/* String pools are not copyable.
+			 */
+						 StringPool(const StringPool &);
+			StringPool &operator	 =(const StringPool &);
+		public:
+			/* Pool used for XML names and other identifiers.
+			 */
+			static StringPool	&GetGlobal();
+
+						 StringPool();
+						~StringPool();
+
+			Int			 Length() const;
+
+			/* Return the pooled copy of a string,
+			 * adding it to the pool if necessary.
+			 */
+			const String		*Intern(const String &);
+
+			/* Return the pooled copy of a string
+			 * or NIL if it is not in the pool.
+			 */
+			const String		*Find(const String &) const;
+	};
+};
+
+#endif
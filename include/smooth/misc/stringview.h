@@ -0,0 +1,87 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_STRINGVIEW
+#define H_OBJSMOOTH_STRINGVIEW
+
+namespace smooth
+{
+	class StringView;
+	class StringTokenizer;
+};
+
+#include "string.h"
+
+namespace smooth
+{
+	/* Read only view of a range of characters in a string.
+	 *
+	 * Views do not copy any data. They become invalid when the
+	 * string they refer to is modified or destroyed.
+	 */
+	class SMOOTHAPI StringView
+	{
+		private:
+			const wchar_t		*chars;
+			Int			 length;
+		public:
+						 StringView() : chars(NIL), length(0)					{ }
+						 StringView(const String &);
+						 StringView(const wchar_t *iChars, Int iLength) : chars(iChars), length(iLength)	{ }
+
+			Int			 Length() const		{ return length; }
+			const wchar_t		*GetChars() const	{ return chars; }
+
+			Int			 Find(const StringView &) const;
+			Int			 FindLast(const StringView &) const;
+
+			Int			 Compare(const StringView &) const;
+
+			Bool			 StartsWith(const StringView &) const;
+			Bool			 EndsWith(const StringView &) const;
+
+			StringView		 SubString(Int, Int) const;
+
+			StringView		 Head(Int) const;
+			StringView		 Tail(Int) const;
+
+			StringView		 Trim() const;
+
+			Int64			 ToInt() const;
+			Float			 ToFloat() const;
+
+			String			 ToString() const;
+
+			wchar_t operator	 [](const int n) const	{ return chars[n]; }
+
+			Bool operator		 ==(const StringView &) const;
+			Bool operator		 !=(const StringView &) const;
+	};
+
+	/* Splits a string at each occurrence of a delimiter, yielding
+	 * the same parts as String::Explode as views into the string.
+	 *
+	 * The string must outlive the tokenizer and its tokens.
+	 */
+	class SMOOTHAPI StringTokenizer
+	{
+		private:
+			StringView		 string;
+			String			 delimiter;
+
+			Int			 position;
+		public:
+						 StringTokenizer(const StringView &, const String &);
+
+			Bool			 Next(StringView &);
+	};
+};
+
+#endif
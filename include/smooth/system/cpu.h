@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2019 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -57,6 +57,11 @@ namespace smooth
 				static Bool	 hasAVX;
 				static Bool	 hasAVX2;
 
+				static Bool	 hasPCLMUL;
+				static Bool	 hasPMULL;
+
+				static Bool	 hasSHA;
+
 				static Bool	 has3DNow;
 				static Bool	 has3DNowExt;
 
@@ -94,6 +99,11 @@ namespace smooth
 				Bool		 HasAVX() const			{ return hasAVX; }
 				Bool		 HasAVX2() const		{ return hasAVX2; }
 
+				Bool		 HasPCLMUL() const		{ return hasPCLMUL; }
+				Bool		 HasPMULL() const		{ return hasPMULL; }
+
+				Bool		 HasSHA() const			{ return hasSHA; }
+
 				Bool		 Has3DNow() const		{ return has3DNow; }
 				Bool		 Has3DNowExt() const		{ return has3DNowExt; }
 
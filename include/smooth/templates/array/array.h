@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2019 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -19,13 +19,30 @@ namespace smooth
 	{
 		public:
 					 Array()						{ }
+					 Array(const Array<t, s> &oArray) : ArrayBackend<s>(oArray)	{ }
+
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+					 Array(Array<t, s> &&oArray) : ArrayBackend<s>(static_cast<ArrayBackend<s> &&>(oArray)) { }
+#endif
+
 			virtual		~Array()						{ }
 
+			Array<t, s> &operator	 =(const Array<t, s> &oArray)			{ ArrayBackend<s>::operator =(oArray); return *this; }
+
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Array<t, s> &operator	 =(Array<t, s> &&oArray)			{ ArrayBackend<s>::operator =(static_cast<ArrayBackend<s> &&>(oArray)); return *this; }
+#endif
+
 			/* Methods for adding entries to the list.
 			 */
 			Int		 Add(const t &value)					{ return ArrayBackend<s>::Add((const s &) value); }
 			Bool		 Add(const t &value, Int index)				{ return ArrayBackend<s>::Add((const s &) value, index); }
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Int		 Add(t &&value)						{ return ArrayBackend<s>::Add((s &&) value); }
+			Bool		 Add(t &&value, Int index)				{ return ArrayBackend<s>::Add((s &&) value, index); }
+#endif
+
 			/* Methods for inserting entries at defined positions.
 			 */
 			Int		 InsertAfter(Int index, const t &value)			{ return ArrayBackend<s>::InsertAfter(index, (const s &) value); }
@@ -33,7 +50,18 @@ namespace smooth
 			Int		 InsertAtPos(Int pos, const t &value)			{ return ArrayBackend<s>::InsertAtPos(pos, (const s &) value); }
 			Bool		 InsertAtPos(Int pos, const t &value, Int nIndex)	{ return ArrayBackend<s>::InsertAtPos(pos, (const s &) value, nIndex); }
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Int		 InsertAtPos(Int pos, t &&value)			{ return ArrayBackend<s>::InsertAtPos(pos, (s &&) value); }
+			Bool		 InsertAtPos(Int pos, t &&value, Int nIndex)		{ return ArrayBackend<s>::InsertAtPos(pos, (s &&) value, nIndex); }
+#endif
+
 			/* Getter and setter methods.
+			 *
+			 * Values of types marked via ArrayInline (fundamental types
+			 * and pointers) are stored inline, so references returned by
+			 * the getters below become invalid when entries are added,
+			 * inserted or removed. References to other values stay valid
+			 * until their own entry is removed.
 			 */
 			const t		&Get(Int index) const					{ return (const t &) ArrayBackend<s>::Get(index); }
 			Bool		 Set(Int index, const t &value)				{ return ArrayBackend<s>::Set(index, (const s &) value); }
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2021 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -12,26 +12,16 @@
 #define H_OBJSMOOTH_ARRAY_BACKEND
 
 #include "../../misc/array.h"
-
-#include <memory.h>
-#include <string.h>
+#include "arraystorage.h"
 
 namespace smooth
 {
-	template <class s> class ArrayEntry
-	{
-		public:
-			s	 value;
-
-				 ArrayEntry(const s &iValue) : value(iValue) { }
-	};
-
 	template <class s> class ArrayBackend : public IndexArray
 	{
 		private:
 			static s		 nullValue;
 
-			Buffer<ArrayEntry<s> *>	 entries;
+			ArrayStorage<s>		 entries;
 		public:
 			ArrayBackend()
 			{
@@ -42,6 +32,13 @@ namespace smooth
 				*this = oArray;
 			}
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			ArrayBackend(ArrayBackend<s> &&oArray) : IndexArray()
+			{
+				*this = static_cast<ArrayBackend<s> &&>(oArray);
+			}
+#endif
+
 			virtual	~ArrayBackend()
 			{
 				RemoveAll();
@@ -61,6 +58,24 @@ namespace smooth
 				return *this;
 			}
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			ArrayBackend<s> &operator =(ArrayBackend<s> &&oArray)
+			{
+				if (&oArray == this) return *this;
+
+				WriteLock	 lockOther(oArray);
+				WriteLock	 lock(*this);
+
+				RemoveAll();
+
+				IndexArray::Swap(oArray);
+
+				entries.Swap(oArray.entries);
+
+				return *this;
+			}
+#endif
+
 			Int Add(const s &value)
 			{
 				WriteLock	 lock(*this);
@@ -78,13 +93,50 @@ namespace smooth
 
 				if (!IndexArray::InsertAtPos(nOfEntries, index)) return False;
 
-				if (entries.Size() == nOfEntries) entries.Resize(8 > nOfEntries * 1.25 ? 8 : nOfEntries * 1.25);
+				entries.Insert(nOfEntries, nOfEntries, value);
+
+				return True;
+			}
+
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Int Add(s &&value)
+			{
+				WriteLock	 lock(*this);
+				Int		 index = greatestIndex + 1;
+
+				if (!Add(static_cast<s &&>(value), index)) index = -1;
 
-				entries[nOfEntries] = new ArrayEntry<s>(value);
+				return index;
+			}
+
+			Bool Add(s &&value, Int index)
+			{
+				WriteLock	 lock(*this);
+				Int		 nOfEntries = this->nOfEntries;
+
+				if (!IndexArray::InsertAtPos(nOfEntries, index)) return False;
+
+				entries.Insert(nOfEntries, nOfEntries, static_cast<s &&>(value));
 
 				return True;
 			}
 
+			/* Construct a new entry in place at the end of the array.
+			 */
+			template <class... Args> Int Emplace(Args &&... args)
+			{
+				WriteLock	 lock(*this);
+				Int		 nOfEntries = this->nOfEntries;
+				Int		 index	    = greatestIndex + 1;
+
+				if (!IndexArray::InsertAtPos(nOfEntries, index)) return -1;
+
+				entries.Emplace(nOfEntries, nOfEntries, static_cast<Args &&>(args)...);
+
+				return index;
+			}
+#endif
+
 			Int InsertAfter(Int prevIndex, const s &value)
 			{
 				WriteLock	 lock(*this);
@@ -121,14 +173,36 @@ namespace smooth
 
 				if (!IndexArray::InsertAtPos(position, index)) return False;
 
-				if (entries.Size() == nOfEntries) entries.Resize(8 > nOfEntries * 1.25 ? 8 : nOfEntries * 1.25);
+				entries.Insert(position, nOfEntries, value);
+
+				return True;
+			}
+
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Int InsertAtPos(Int position, s &&value)
+			{
+				WriteLock	 lock(*this);
+				Int		 index = greatestIndex + 1;
+
+				if (!InsertAtPos(position, static_cast<s &&>(value), index)) index = -1;
+
+				return index;
+			}
+
+			Bool InsertAtPos(Int position, s &&value, Int index)
+			{
+				WriteLock	 lock(*this);
+				Int		 nOfEntries = this->nOfEntries;
+
+				if (position > nOfEntries || position < 0) return False;
 
-				memmove(entries + position + 1, entries + position, (nOfEntries - position) * sizeof(ArrayEntry<s> *));
+				if (!IndexArray::InsertAtPos(position, index)) return False;
 
-				entries[position] = new ArrayEntry<s>(value);
+				entries.Insert(position, nOfEntries, static_cast<s &&>(value));
 
 				return True;
 			}
+#endif
 
 			Bool MoveNth(Int n, Int m)
 			{
@@ -137,12 +211,7 @@ namespace smooth
 				if (nOfEntries <= n || n < 0 ||
 				    nOfEntries <= m || m < 0) return False;
 
-				ArrayEntry<s>	*backupEntry = entries[n];
-
-				if (m < n) memmove(entries + m + 1, entries + m, (n - m) * sizeof(ArrayEntry<s> *));
-				else	   memmove(entries + n, entries + n + 1, (m - n) * sizeof(ArrayEntry<s> *));
-
-				entries[m] = backupEntry;
+				entries.Move(n, m);
 
 				return IndexArray::MoveNth(n, m);
 			}
@@ -155,9 +224,7 @@ namespace smooth
 
 				if (nOfEntries == 1) return RemoveAll();
 
-				delete entries[n];
-
-				memmove(entries + n, entries + n + 1, (nOfEntries - n - 1) * sizeof(ArrayEntry<s> *));
+				entries.Remove(n, nOfEntries);
 
 				return IndexArray::RemoveNth(n);
 			}
@@ -168,9 +235,7 @@ namespace smooth
 
 				if (nOfEntries == 0) return True;
 
-				for (Int i = 0; i < nOfEntries; i++) delete entries[i];
-
-				entries.Free();
+				entries.RemoveAll(nOfEntries);
 
 				return IndexArray::RemoveAll();
 			}
@@ -209,7 +274,7 @@ namespace smooth
 
 				if (nOfEntries > n && n >= 0)
 				{
-					const s	&entry = entries[n]->value;
+					const s	&entry = entries[n];
 
 					lastAccessedEntry = n;
 
@@ -225,7 +290,7 @@ namespace smooth
 
 				if (nOfEntries > n && n >= 0)
 				{
-					s	&entry = entries[n]->value;
+					s	&entry = entries[n];
 
 					lastAccessedEntry = n;
 
@@ -241,7 +306,7 @@ namespace smooth
 
 				if (nOfEntries > n && n >= 0)
 				{
-					const s	&entry = entries[n]->value;
+					const s	&entry = entries[n];
 
 					lastAccessedEntry = n;
 
@@ -257,7 +322,7 @@ namespace smooth
 
 				if (nOfEntries > n && n >= 0)
 				{
-					entries[n]->value = value;
+					entries[n] = value;
 
 					lastAccessedEntry = n;
 
@@ -273,7 +338,7 @@ namespace smooth
 
 				if (nOfEntries > 0)
 				{
-					const s	&entry = entries[0]->value;
+					const s	&entry = entries[0];
 
 					lastAccessedEntry = 0;
 
@@ -289,7 +354,7 @@ namespace smooth
 
 				if (nOfEntries > 0)
 				{
-					const s	&entry = entries[nOfEntries - 1]->value;
+					const s	&entry = entries[nOfEntries - 1];
 
 					lastAccessedEntry = nOfEntries - 1;
 
@@ -306,7 +371,7 @@ namespace smooth
 
 				if (lastAccessed < nOfEntries - 1)
 				{
-					const s	&entry = entries[++lastAccessed]->value;
+					const s	&entry = entries[++lastAccessed];
 
 					lastAccessedEntry = lastAccessed;
 
@@ -323,7 +388,7 @@ namespace smooth
 
 				if (lastAccessed > 0)
 				{
-					const s	&entry = entries[--lastAccessed]->value;
+					const s	&entry = entries[--lastAccessed];
 
 					lastAccessedEntry = lastAccessed;
 
@@ -0,0 +1,262 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_ARRAY_STORAGE
+#define H_OBJSMOOTH_ARRAY_STORAGE
+
+#include "../buffer.h"
+
+#include <memory.h>
+#include <string.h>
+#include <new>
+
+namespace smooth
+{
+	/* Trait telling whether values of a type may be stored inline.
+	 *
+	 * Types marked here must be relocatable, i.e. an object must
+	 * stay valid after being moved to another address via memmove.
+	 * This is true for fundamental types and pointers as well as
+	 * classes not holding pointers to themselves.
+	 *
+	 * Inline values are moved when the array grows or shrinks, which
+	 * invalidates references to them. Only mark plain data types here,
+	 * as classes are commonly referenced across array modifications.
+	 */
+	template <class s> class ArrayInline
+	{
+		public:
+			static const Bool	 Value = False;
+	};
+
+	template <class s> class ArrayInline<s *>
+	{
+		public:
+			static const Bool	 Value = True;
+	};
+
+#define SMOOTH_ARRAY_INLINE(type)				\
+	template <> class ArrayInline<type>			\
+	{							\
+		public:						\
+			static const Bool	 Value = True;	\
+	};
+
+	SMOOTH_ARRAY_INLINE(bool)
+	SMOOTH_ARRAY_INLINE(char)
+	SMOOTH_ARRAY_INLINE(signed char)
+	SMOOTH_ARRAY_INLINE(unsigned char)
+	SMOOTH_ARRAY_INLINE(wchar_t)
+	SMOOTH_ARRAY_INLINE(short)
+	SMOOTH_ARRAY_INLINE(unsigned short)
+	SMOOTH_ARRAY_INLINE(int)
+	SMOOTH_ARRAY_INLINE(unsigned int)
+	SMOOTH_ARRAY_INLINE(long)
+	SMOOTH_ARRAY_INLINE(unsigned long)
+	SMOOTH_ARRAY_INLINE(__int64)
+	SMOOTH_ARRAY_INLINE(unsigned __int64)
+	SMOOTH_ARRAY_INLINE(float)
+	SMOOTH_ARRAY_INLINE(double)
+
+	template <class s> class ArrayEntry
+	{
+		public:
+			s	 value;
+
+				 ArrayEntry(const s &iValue) : value(iValue) { }
+
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+				 template <class... Args> ArrayEntry(Args &&... args) : value(static_cast<Args &&>(args)...) { }
+#endif
+	};
+
+	/* Default array storage keeping each value
+	 * in a separately allocated entry.
+	 */
+	template <class s, Bool inlineStorage = ArrayInline<s>::Value> class ArrayStorage
+	{
+		private:
+			Buffer<ArrayEntry<s> *>	 entries;
+
+			/* Make room for a new entry at position.
+			 */
+			Void Open(Int position, Int nOfEntries)
+			{
+				if (entries.Size() == nOfEntries) entries.Resize(8 > nOfEntries * 1.25 ? 8 : nOfEntries * 1.25);
+
+				memmove(entries + position + 1, entries + position, (nOfEntries - position) * sizeof(ArrayEntry<s> *));
+			}
+		public:
+			Void Insert(Int position, Int nOfEntries, const s &value)
+			{
+				ArrayEntry<s>	*entry = new ArrayEntry<s>(value);
+
+				Open(position, nOfEntries);
+
+				entries[position] = entry;
+			}
+
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Void Insert(Int position, Int nOfEntries, s &&value)
+			{
+				Emplace(position, nOfEntries, static_cast<s &&>(value));
+			}
+
+			template <class... Args> Void Emplace(Int position, Int nOfEntries, Args &&... args)
+			{
+				ArrayEntry<s>	*entry = new ArrayEntry<s>(static_cast<Args &&>(args)...);
+
+				Open(position, nOfEntries);
+
+				entries[position] = entry;
+			}
+#endif
+
+			Void Move(Int n, Int m)
+			{
+				ArrayEntry<s>	*backupEntry = entries[n];
+
+				if (m < n) memmove(entries + m + 1, entries + m, (n - m) * sizeof(ArrayEntry<s> *));
+				else	   memmove(entries + n, entries + n + 1, (m - n) * sizeof(ArrayEntry<s> *));
+
+				entries[m] = backupEntry;
+			}
+
+			Void Remove(Int n, Int nOfEntries)
+			{
+				delete entries[n];
+
+				memmove(entries + n, entries + n + 1, (nOfEntries - n - 1) * sizeof(ArrayEntry<s> *));
+			}
+
+			Void RemoveAll(Int nOfEntries)
+			{
+				for (Int i = 0; i < nOfEntries; i++) delete entries[i];
+
+				entries.Free();
+			}
+
+			Void Swap(ArrayStorage<s, False> &oStorage)
+			{
+				entries.Swap(oStorage.entries);
+			}
+
+			inline s &operator	 [](Int n)		{ return entries[n]->value; }
+			inline const s &operator [](Int n) const	{ return entries[n]->value; }
+	};
+
+	/* Inline array storage keeping all values densely
+	 * packed in a single allocation.
+	 */
+	template <class s> class ArrayStorage<s, True>
+	{
+		private:
+			Buffer<s>		 entries;
+
+			/* Make room for a new entry at position
+			 * and return its uninitialized memory.
+			 */
+			Void *Open(Int position, Int nOfEntries)
+			{
+				if (entries.Size() == nOfEntries) entries.Resize(8 > nOfEntries * 1.25 ? 8 : nOfEntries * 1.25);
+
+				s	*values = entries;
+
+				memmove((Void *) (values + position + 1), (Void *) (values + position), (nOfEntries - position) * sizeof(s));
+
+				return (Void *) (values + position);
+			}
+		public:
+			Void Insert(Int position, Int nOfEntries, const s &value)
+			{
+				s	*values = entries;
+
+				/* Copy value first if it refers to one of our own
+				 * entries as it will be moved or reallocated below.
+				 */
+				if (&value >= values && &value < values + nOfEntries)
+				{
+					s	 copy(value);
+
+					Insert(position, nOfEntries, copy);
+
+					return;
+				}
+
+				new (Open(position, nOfEntries)) s(value);
+			}
+
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Void Insert(Int position, Int nOfEntries, s &&value)
+			{
+				s	*values = entries;
+
+				if (&value >= values && &value < values + nOfEntries)
+				{
+					s	 copy(static_cast<s &&>(value));
+
+					Insert(position, nOfEntries, static_cast<s &&>(copy));
+
+					return;
+				}
+
+				new (Open(position, nOfEntries)) s(static_cast<s &&>(value));
+			}
+
+			/* Arguments must not refer to entries of this array.
+			 */
+			template <class... Args> Void Emplace(Int position, Int nOfEntries, Args &&... args)
+			{
+				new (Open(position, nOfEntries)) s(static_cast<Args &&>(args)...);
+			}
+#endif
+
+			Void Move(Int n, Int m)
+			{
+				s		*values = entries;
+				UnsignedByte	 backupEntry[sizeof(s)];
+
+				memcpy(backupEntry, (Void *) (values + n), sizeof(s));
+
+				if (m < n) memmove((Void *) (values + m + 1), (Void *) (values + m), (n - m) * sizeof(s));
+				else	   memmove((Void *) (values + n), (Void *) (values + n + 1), (m - n) * sizeof(s));
+
+				memcpy((Void *) (values + m), backupEntry, sizeof(s));
+			}
+
+			Void Remove(Int n, Int nOfEntries)
+			{
+				s	*values = entries;
+
+				values[n].~s();
+
+				memmove((Void *) (values + n), (Void *) (values + n + 1), (nOfEntries - n - 1) * sizeof(s));
+			}
+
+			Void RemoveAll(Int nOfEntries)
+			{
+				s	*values = entries;
+
+				for (Int i = 0; i < nOfEntries; i++) values[i].~s();
+
+				entries.Free();
+			}
+
+			Void Swap(ArrayStorage<s, True> &oStorage)
+			{
+				entries.Swap(oStorage.entries);
+			}
+
+			inline s &operator	 [](Int n)		{ return ((s *) entries)[n]; }
+			inline const s &operator [](Int n) const	{ return ((s *) entries)[n]; }
+	};
+};
+
+#endif
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2009 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -12,5 +12,6 @@
 #define H_OBJSMOOTH_BUFFER_INCLUDE
 
 #include "buffer/buffer.h"
+#include "buffer/smallbuffer.h"
 
 #endif
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2017 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -47,6 +47,18 @@ namespace smooth
 				*this = oBuffer;
 			}
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Buffer(Buffer<t> &&oBuffer)
+			{
+				memory		= NIL;
+
+				size		= 0;
+				allocated	= 0;
+
+				Swap(oBuffer);
+			}
+#endif
+
 			virtual ~Buffer()
 			{
 				Free();
@@ -64,6 +76,41 @@ namespace smooth
 				return *this;
 			}
 
+#ifdef SMOOTH_HAS_MOVE_SEMANTICS
+			Buffer<t> &operator =(Buffer<t> &&oBuffer)
+			{
+				if (&oBuffer == this) return *this;
+
+				Free();
+
+				memory		= NIL;
+
+				size		= 0;
+				allocated	= 0;
+
+				Swap(oBuffer);
+
+				return *this;
+			}
+#endif
+
+			/* Exchange contents with another buffer.
+			 */
+			Void Swap(Buffer<t> &oBuffer)
+			{
+				Memory	*oMemory    = oBuffer.memory;
+				Int	 oSize	    = oBuffer.size;
+				Int	 oAllocated = oBuffer.allocated;
+
+				oBuffer.memory	  = memory;
+				oBuffer.size	  = size;
+				oBuffer.allocated = allocated;
+
+				memory		= oMemory;
+				size		= oSize;
+				allocated	= oAllocated;
+			}
+
 			Int Size() const
 			{
 				return size;
@@ -0,0 +1,142 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_SMALLBUFFER
+#define H_OBJSMOOTH_SMALLBUFFER
+
+#include "../../definitions.h"
+
+#include <memory.h>
+#include <stdlib.h>
+
+namespace smooth
+{
+	/* Buffer of plain data keeping up to n elements inline
+	 * and only allocating heap memory for larger sizes.
+	 *
+	 * Small buffers hold no pointers to themselves and may be
+	 * relocated with memmove. Pointers returned by operator t *
+	 * become invalid when the buffer is moved or resized.
+	 */
+	template <class t, int n> class SmallBuffer
+	{
+		private:
+			union
+			{
+				t	*heapMemory;
+				t	 localMemory[n];
+			};
+
+			Int		 size;
+			Int		 capacity;
+
+			/* Small buffers are not copyable.
+			 */
+					 SmallBuffer(const SmallBuffer<t, n> &);
+			SmallBuffer<t, n> &operator =(const SmallBuffer<t, n> &);
+
+			inline Bool	 IsLocal() const		{ return capacity <= n; }
+		public:
+			SmallBuffer()
+			{
+				size		= 0;
+				capacity	= 0;
+			}
+
+			~SmallBuffer()
+			{
+				Free();
+			}
+
+			Int Size() const
+			{
+				return size;
+			}
+
+			Bool Resize(Int nSize)
+			{
+				/* Let's see if we really need to reallocate.
+				 */
+				if (nSize <= capacity)
+				{
+					size		= nSize;
+
+					return True;
+				}
+
+				if (nSize <= n)
+				{
+					size		= nSize;
+					capacity	= n;
+
+					return True;
+				}
+
+				/* Move to or grow heap memory.
+				 */
+				t	*memory = NIL;
+
+				if (IsLocal())
+				{
+					if ((memory = (t *) malloc(nSize * sizeof(t))) == NIL) return False;
+
+					if (capacity > 0) memcpy(memory, localMemory, capacity * sizeof(t));
+				}
+				else
+				{
+					if ((memory = (t *) realloc(heapMemory, nSize * sizeof(t))) == NIL) return False;
+				}
+
+				heapMemory	= memory;
+
+				size		= nSize;
+				capacity	= nSize;
+
+				return True;
+			}
+
+			Bool Zero()
+			{
+				if (capacity == 0) return True;
+
+				memset((void *) (t *) *this, 0, size * sizeof(t));
+
+				return True;
+			}
+
+			Bool Free()
+			{
+				if (!IsLocal()) free(heapMemory);
+
+				size		= 0;
+				capacity	= 0;
+
+				return True;
+			}
+
+			/* Exchange contents with another buffer.
+			 */
+			Void Swap(SmallBuffer<t, n> &oBuffer)
+			{
+				UnsignedByte	 backup[sizeof(SmallBuffer<t, n>)];
+
+				memcpy(backup, (void *) &oBuffer, sizeof(SmallBuffer<t, n>));
+				memcpy((void *) &oBuffer, (void *) this, sizeof(SmallBuffer<t, n>));
+				memcpy((void *) this, backup, sizeof(SmallBuffer<t, n>));
+			}
+
+			inline t &operator	 [](const int i)	{ return (IsLocal() ? localMemory : heapMemory)[i]; }
+			inline t operator	 [](const int i) const	{ return (IsLocal() ? localMemory : heapMemory)[i]; }
+
+			inline operator		 t *() const		{ return capacity == 0 ? NIL : (IsLocal() ? (t *) localMemory : heapMemory); }
+	};
+};
+
+#endif
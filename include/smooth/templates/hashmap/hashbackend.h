@@ -0,0 +1,120 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_HASH_BACKEND
+#define H_OBJSMOOTH_HASH_BACKEND
+
+#include "../../misc/hashindex.h"
+#include "../array/arraystorage.h"
+#include "hashkey.h"
+
+namespace smooth
+{
+	template <class k> class HashBackend : public HashIndex
+	{
+		private:
+			static k		 nullKey;
+		protected:
+			ArrayStorage<k>		 keys;
+
+			inline UnsignedInt64 ComputeHash(const k &key) const
+			{
+				return HashKey<k>::Compute(key, seed);
+			}
+
+			/* Find the entry for a key, comparing full
+			 * hash values first to resolve collisions.
+			 */
+			Int Lookup(const k &key, UnsignedInt64 hash) const
+			{
+				if (nOfEntries == 0) return -1;
+
+				for (Int slot = hash & tableMask; table[slot] != -1; slot = (slot + 1) & tableMask)
+				{
+					Int	 entry = table[slot];
+
+					if (hashes[entry] == hash && keys[entry] == key) return entry;
+				}
+
+				return -1;
+			}
+
+			Int AddKey(const k &key, UnsignedInt64 hash)
+			{
+				Int	 entry = InsertEntry(hash);
+
+				keys.Insert(entry, entry, key);
+
+				return entry;
+			}
+
+			/* Remove a key, moving the last key into its place.
+			 */
+			Void RemoveKey(Int entry)
+			{
+				Int	 last = nOfEntries - 1;
+
+				RemoveEntry(entry);
+
+				if (entry != last) keys[entry] = keys[last];
+
+				keys.Remove(last, last + 1);
+			}
+		public:
+			HashBackend()
+			{
+			}
+
+			virtual	~HashBackend()
+			{
+				RemoveAll();
+			}
+
+			virtual Bool RemoveAll()
+			{
+				WriteLock	 lock(*this);
+
+				keys.RemoveAll(nOfEntries);
+
+				return HashIndex::RemoveAll();
+			}
+
+			Bool Contains(const k &key) const
+			{
+				ReadLock	 lock(*this);
+
+				return Lookup(key, ComputeHash(key)) >= 0;
+			}
+
+			/* Return the entry number of a key or -1 if
+			 * the key is not present. Entry numbers stay
+			 * valid until an entry is removed.
+			 */
+			Int Find(const k &key) const
+			{
+				ReadLock	 lock(*this);
+
+				return Lookup(key, ComputeHash(key));
+			}
+
+			const k &GetNthKey(Int n) const
+			{
+				ReadLock	 lock(*this);
+
+				if (n < 0 || n >= nOfEntries) return nullKey;
+
+				return keys[n];
+			}
+	};
+};
+
+template <class k> k S::HashBackend<k>::nullKey;
+
+#endif
@@ -0,0 +1,58 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_HASHKEY
+#define H_OBJSMOOTH_HASHKEY
+
+#include "../../misc/hash/wyhash.h"
+
+namespace smooth
+{
+	/* Trait computing hash values of keys.
+	 *
+	 * Classes used as keys must provide a ComputeHash method
+	 * taking a seed value and implement the == operator.
+	 * Fundamental types and pointers are supported directly.
+	 */
+	template <class k> class HashKey
+	{
+		public:
+			static inline UnsignedInt64 Compute(const k &key, UnsignedInt64 seed)	{ return key.ComputeHash(seed); }
+	};
+
+	template <class k> class HashKey<k *>
+	{
+		public:
+			static inline UnsignedInt64 Compute(k *key, UnsignedInt64 seed)	{ return Hash::WyHash::ComputeValue((UnsignedInt64) (size_t) key, seed); }
+	};
+
+#define SMOOTH_HASHKEY_VALUE(type)									\
+	template <> class HashKey<type>									\
+	{												\
+		public:											\
+			static inline UnsignedInt64 Compute(type key, UnsignedInt64 seed)	{ return Hash::WyHash::ComputeValue((UnsignedInt64) key, seed); }	\
+	};
+
+	SMOOTH_HASHKEY_VALUE(bool)
+	SMOOTH_HASHKEY_VALUE(char)
+	SMOOTH_HASHKEY_VALUE(signed char)
+	SMOOTH_HASHKEY_VALUE(unsigned char)
+	SMOOTH_HASHKEY_VALUE(wchar_t)
+	SMOOTH_HASHKEY_VALUE(short)
+	SMOOTH_HASHKEY_VALUE(unsigned short)
+	SMOOTH_HASHKEY_VALUE(int)
+	SMOOTH_HASHKEY_VALUE(unsigned int)
+	SMOOTH_HASHKEY_VALUE(long)
+	SMOOTH_HASHKEY_VALUE(unsigned long)
+	SMOOTH_HASHKEY_VALUE(__int64)
+	SMOOTH_HASHKEY_VALUE(unsigned __int64)
+};
+
+#endif
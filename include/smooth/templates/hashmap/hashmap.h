@@ -0,0 +1,177 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_HASHMAP
+#define H_OBJSMOOTH_HASHMAP
+
+#include "hashbackend.h"
+
+namespace smooth
+{
+	/* Hash map storing values by key.
+	 *
+	 * Values can be iterated in insertion order using GetNth as
+	 * long as no entries are removed; removing an entry moves
+	 * the last entry into its place.
+	 */
+	template <class k, class v> class HashMap : public HashBackend<k>
+	{
+		private:
+			static v		 nullValue;
+
+			ArrayStorage<v>		 values;
+
+			typedef HashIndex::ReadLock		 ReadLock;
+			typedef HashIndex::WriteLock		 WriteLock;
+		public:
+			HashMap()
+			{
+			}
+
+			HashMap(const HashMap<k, v> &oMap) : HashBackend<k>()
+			{
+				*this = oMap;
+			}
+
+			virtual	~HashMap()
+			{
+				RemoveAll();
+			}
+
+			HashMap<k, v> &operator =(const HashMap<k, v> &oMap)
+			{
+				if (&oMap == this) return *this;
+
+				ReadLock	 read(oMap);
+				WriteLock	 write(*this);
+
+				RemoveAll();
+
+				/* Take over seed to reuse hash values.
+				 */
+				this->seed = oMap.seed;
+
+				for (Int i = 0; i < oMap.nOfEntries; i++)
+				{
+					Int	 entry = this->AddKey(oMap.keys[i], oMap.hashes[i]);
+
+					values.Insert(entry, entry, oMap.values[i]);
+				}
+
+				return *this;
+			}
+
+			/* Add a value for a new key. Fails
+			 * if the key is already present.
+			 */
+			Bool Add(const k &key, const v &value)
+			{
+				WriteLock	 lock(*this);
+				UnsignedInt64	 hash = this->ComputeHash(key);
+
+				if (this->Lookup(key, hash) >= 0) return False;
+
+				Int	 entry = this->AddKey(key, hash);
+
+				values.Insert(entry, entry, value);
+
+				return True;
+			}
+
+			/* Set the value for a key, adding
+			 * the key if it is not present.
+			 */
+			Bool Set(const k &key, const v &value)
+			{
+				WriteLock	 lock(*this);
+				UnsignedInt64	 hash  = this->ComputeHash(key);
+				Int		 entry = this->Lookup(key, hash);
+
+				if (entry >= 0)
+				{
+					values[entry] = value;
+
+					return True;
+				}
+
+				entry = this->AddKey(key, hash);
+
+				values.Insert(entry, entry, value);
+
+				return True;
+			}
+
+			const v &Get(const k &key) const
+			{
+				ReadLock	 lock(*this);
+				Int		 entry = this->Lookup(key, this->ComputeHash(key));
+
+				if (entry < 0) return nullValue;
+
+				return values[entry];
+			}
+
+			Bool Remove(const k &key)
+			{
+				WriteLock	 lock(*this);
+				Int		 entry = this->Lookup(key, this->ComputeHash(key));
+
+				if (entry < 0) return False;
+
+				Int	 last = this->nOfEntries - 1;
+
+				this->RemoveKey(entry);
+
+				if (entry != last) values[entry] = values[last];
+
+				values.Remove(last, last + 1);
+
+				return True;
+			}
+
+			virtual Bool RemoveAll()
+			{
+				WriteLock	 lock(*this);
+
+				values.RemoveAll(this->nOfEntries);
+
+				return HashBackend<k>::RemoveAll();
+			}
+
+			/* Access values by entry number.
+			 */
+			const v &GetNth(Int n) const
+			{
+				ReadLock	 lock(*this);
+
+				if (n < 0 || n >= this->nOfEntries) return nullValue;
+
+				return values[n];
+			}
+
+			v &GetNthReference(Int n)
+			{
+				ReadLock	 lock(*this);
+
+				if (n < 0 || n >= this->nOfEntries) return nullValue;
+
+				return values[n];
+			}
+
+			const v &GetNthReference(Int n) const
+			{
+				return GetNth(n);
+			}
+	};
+};
+
+template <class k, class v> v S::HashMap<k, v>::nullValue;
+
+#endif
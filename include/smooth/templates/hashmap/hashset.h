@@ -0,0 +1,90 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_HASHSET
+#define H_OBJSMOOTH_HASHSET
+
+#include "hashbackend.h"
+
+namespace smooth
+{
+	/* Hash set storing distinct keys.
+	 */
+	template <class k> class HashSet : public HashBackend<k>
+	{
+		private:
+			typedef HashIndex::ReadLock		 ReadLock;
+			typedef HashIndex::WriteLock		 WriteLock;
+		public:
+			HashSet()
+			{
+			}
+
+			HashSet(const HashSet<k> &oSet) : HashBackend<k>()
+			{
+				*this = oSet;
+			}
+
+			virtual	~HashSet()
+			{
+			}
+
+			HashSet<k> &operator =(const HashSet<k> &oSet)
+			{
+				if (&oSet == this) return *this;
+
+				ReadLock	 read(oSet);
+				WriteLock	 write(*this);
+
+				this->RemoveAll();
+
+				/* Take over seed to reuse hash values.
+				 */
+				this->seed = oSet.seed;
+
+				for (Int i = 0; i < oSet.nOfEntries; i++) this->AddKey(oSet.keys[i], oSet.hashes[i]);
+
+				return *this;
+			}
+
+			/* Add a key. Fails if the key is already present.
+			 */
+			Bool Add(const k &key)
+			{
+				WriteLock	 lock(*this);
+				UnsignedInt64	 hash = this->ComputeHash(key);
+
+				if (this->Lookup(key, hash) >= 0) return False;
+
+				this->AddKey(key, hash);
+
+				return True;
+			}
+
+			Bool Remove(const k &key)
+			{
+				WriteLock	 lock(*this);
+				Int		 entry = this->Lookup(key, this->ComputeHash(key));
+
+				if (entry < 0) return False;
+
+				this->RemoveKey(entry);
+
+				return True;
+			}
+
+			/* Access keys by entry number.
+			 */
+			const k &GetNth(Int n) const		{ return this->GetNthKey(n); }
+			const k &GetNthReference(Int n) const	{ return this->GetNthKey(n); }
+	};
+};
+
+#endif
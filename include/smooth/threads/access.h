@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2015 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -16,47 +16,46 @@ namespace smooth
 	namespace Threads
 	{
 		class Access;
-		class Mutex;
 	};
 };
 
 #include "../definitions.h"
+#include "atomic.h"
 
 namespace smooth
 {
 	namespace Threads
 	{
+		/* Sequentially consistent access to shared values.
+		 *
+		 * Increment and Decrement return the new value.
+		 */
 		class SMOOTHAPI Access
 		{
-			private:
-				static Mutex	*mutex;
 			public:
-				static Int	 Initialize();
-				static Int	 Free();
-
 				/* Access functions for Bool.
 				 */
-				static Bool	 Value(volatile Bool &);
+				static inline Bool	 Value(volatile Bool &value)		{ return Atomic::Load(value); }
 
-				static Bool	 Set(volatile Bool &, Bool);
+				static inline Bool	 Set(volatile Bool &value, Bool n)	{ Atomic::Store(value, n); return n; }
 
 				/* Access functions for Short.
 				 */
-				static Short	 Value(volatile Short &);
+				static inline Short	 Value(volatile Short &value)		{ return Atomic::Load(value); }
 
-				static Short	 Increment(volatile Short &);
-				static Short	 Decrement(volatile Short &);
+				static inline Short	 Increment(volatile Short &value)	{ return Atomic::FetchAdd(value, Short(1)) + 1; }
+				static inline Short	 Decrement(volatile Short &value)	{ return Atomic::FetchSub(value, Short(1)) - 1; }
 
-				static Short	 Set(volatile Short &, Short);
+				static inline Short	 Set(volatile Short &value, Short n)	{ Atomic::Store(value, n); return n; }
 
 				/* Access functions for Int.
 				 */
-				static Int	 Value(volatile Int &);
+				static inline Int	 Value(volatile Int &value)		{ return Atomic::Load(value); }
 
-				static Int	 Increment(volatile Int &);
-				static Int	 Decrement(volatile Int &);
+				static inline Int	 Increment(volatile Int &value)		{ return Atomic::FetchAdd(value, 1) + 1; }
+				static inline Int	 Decrement(volatile Int &value)		{ return Atomic::FetchSub(value, 1) - 1; }
 
-				static Int	 Set(volatile Int &, Int);
+				static inline Int	 Set(volatile Int &value, Int n)	{ Atomic::Store(value, n); return n; }
 		};
 	};
 };
@@ -0,0 +1,232 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_THREADS_ATOMIC
+#define H_OBJSMOOTH_THREADS_ATOMIC
+
+namespace smooth
+{
+	namespace Threads
+	{
+		class Atomic;
+	};
+};
+
+#include "../definitions.h"
+
+#if defined _MSC_VER && !defined __clang__
+#	include <intrin.h>
+#endif
+
+namespace smooth
+{
+	namespace Threads
+	{
+		/* Memory ordering constraints for atomic operations.
+		 *
+		 * Values match the __ATOMIC_* constants of GCC and Clang.
+		 */
+		enum MemoryOrder
+		{
+			MemoryOrderRelaxed		= 0,
+			MemoryOrderAcquire		= 2,
+			MemoryOrderRelease		= 3,
+			MemoryOrderAcquireRelease	= 4,
+			MemoryOrderSequential		= 5
+		};
+
+#if defined _MSC_VER && !defined __clang__
+		/* Interlocked intrinsics by operand size.
+		 */
+		template <int size> class AtomicIntrinsics;
+
+		template <> class AtomicIntrinsics<1>
+		{
+			public:
+				typedef char		 Type;
+
+				static inline Type	 Exchange(volatile Type *value, Type n)			{ return _InterlockedExchange8(value, n); }
+				static inline Type	 Add(volatile Type *value, Type n)			{ return _InterlockedExchangeAdd8(value, n); }
+				static inline Type	 And(volatile Type *value, Type n)			{ return _InterlockedAnd8(value, n); }
+				static inline Type	 Or(volatile Type *value, Type n)			{ return _InterlockedOr8(value, n); }
+				static inline Type	 CompareExchange(volatile Type *value, Type n, Type c)	{ return _InterlockedCompareExchange8(value, n, c); }
+		};
+
+		template <> class AtomicIntrinsics<2>
+		{
+			public:
+				typedef short		 Type;
+
+				static inline Type	 Exchange(volatile Type *value, Type n)			{ return _InterlockedExchange16(value, n); }
+				static inline Type	 Add(volatile Type *value, Type n)			{ return _InterlockedExchangeAdd16(value, n); }
+				static inline Type	 And(volatile Type *value, Type n)			{ return _InterlockedAnd16(value, n); }
+				static inline Type	 Or(volatile Type *value, Type n)			{ return _InterlockedOr16(value, n); }
+				static inline Type	 CompareExchange(volatile Type *value, Type n, Type c)	{ return _InterlockedCompareExchange16(value, n, c); }
+		};
+
+		template <> class AtomicIntrinsics<4>
+		{
+			public:
+				typedef long		 Type;
+
+				static inline Type	 Exchange(volatile Type *value, Type n)			{ return _InterlockedExchange(value, n); }
+				static inline Type	 Add(volatile Type *value, Type n)			{ return _InterlockedExchangeAdd(value, n); }
+				static inline Type	 And(volatile Type *value, Type n)			{ return _InterlockedAnd(value, n); }
+				static inline Type	 Or(volatile Type *value, Type n)			{ return _InterlockedOr(value, n); }
+				static inline Type	 CompareExchange(volatile Type *value, Type n, Type c)	{ return _InterlockedCompareExchange(value, n, c); }
+		};
+
+		template <> class AtomicIntrinsics<8>
+		{
+			public:
+				typedef __int64		 Type;
+
+				static inline Type	 Exchange(volatile Type *value, Type n)			{ return _InterlockedExchange64(value, n); }
+				static inline Type	 Add(volatile Type *value, Type n)			{ return _InterlockedExchangeAdd64(value, n); }
+				static inline Type	 And(volatile Type *value, Type n)			{ return _InterlockedAnd64(value, n); }
+				static inline Type	 Or(volatile Type *value, Type n)			{ return _InterlockedOr64(value, n); }
+				static inline Type	 CompareExchange(volatile Type *value, Type n, Type c)	{ return _InterlockedCompareExchange64(value, n, c); }
+		};
+#endif
+
+		/* Lock-free atomic operations on naturally aligned values
+		 * of 1, 2, 4 or 8 bytes, i.e. Bool, Short, Int, Int64 and
+		 * pointers.
+		 *
+		 * FetchAdd, FetchSub, FetchAnd and FetchOr are meant for
+		 * integer types only and return the value held before the
+		 * operation, just like Exchange.
+		 *
+		 * CompareExchange stores desired if value equals expected
+		 * and returns True. Otherwise it stores the current value
+		 * in expected and returns False.
+		 */
+		class Atomic
+		{
+#if defined __ATOMIC_RELAXED
+			private:
+				static inline Int		 FailureOrder(MemoryOrder order)								{ return order == MemoryOrderRelease ? MemoryOrderRelaxed : (order == MemoryOrderAcquireRelease ? MemoryOrderAcquire : order); }
+			public:
+				template <class t> static inline t	 Load(const volatile t &value, MemoryOrder order = MemoryOrderSequential)			{ return __atomic_load_n(&value, order); }
+				template <class t> static inline Void	 Store(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)			{ __atomic_store_n(&value, n, order); }
+
+				template <class t> static inline t	 Exchange(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)			{ return __atomic_exchange_n(&value, n, order); }
+
+				template <class t> static inline t	 FetchAdd(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)			{ return __atomic_fetch_add(&value, n, order); }
+				template <class t> static inline t	 FetchSub(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)			{ return __atomic_fetch_sub(&value, n, order); }
+
+				template <class t> static inline t	 FetchAnd(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)			{ return __atomic_fetch_and(&value, n, order); }
+				template <class t> static inline t	 FetchOr(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)			{ return __atomic_fetch_or(&value, n, order); }
+
+				template <class t> static inline Bool	 CompareExchange(volatile t &value, t &expected, t desired, MemoryOrder order = MemoryOrderSequential)	{ return __atomic_compare_exchange_n(&value, &expected, desired, False, order, FailureOrder(order)); }
+
+				static inline Void			 Fence(MemoryOrder order = MemoryOrderSequential)						{ __atomic_thread_fence(order); }
+#elif defined __GNUC__
+			/* Older GCC versions only provide the __sync builtins
+			 * implying a full barrier on every operation.
+			 */
+			public:
+				template <class t> static inline t	 Load(const volatile t &value, MemoryOrder order = MemoryOrderSequential)			{ t result = value; if (order != MemoryOrderRelaxed) __sync_synchronize(); return result; }
+				template <class t> static inline Void	 Store(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)			{ if (order != MemoryOrderRelaxed) __sync_synchronize(); value = n; if (order == MemoryOrderSequential) __sync_synchronize(); }
+
+				template <class t> static inline t	 Exchange(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)			{ t result = value; while (!CompareExchange(value, result, n, order)) { } return result; }
+
+				template <class t> static inline t	 FetchAdd(volatile t &value, t n, MemoryOrder = MemoryOrderSequential)				{ return __sync_fetch_and_add(&value, n); }
+				template <class t> static inline t	 FetchSub(volatile t &value, t n, MemoryOrder = MemoryOrderSequential)				{ return __sync_fetch_and_sub(&value, n); }
+
+				template <class t> static inline t	 FetchAnd(volatile t &value, t n, MemoryOrder = MemoryOrderSequential)				{ return __sync_fetch_and_and(&value, n); }
+				template <class t> static inline t	 FetchOr(volatile t &value, t n, MemoryOrder = MemoryOrderSequential)				{ return __sync_fetch_and_or(&value, n); }
+
+				template <class t> static inline Bool	 CompareExchange(volatile t &value, t &expected, t desired, MemoryOrder = MemoryOrderSequential)	{ t previous = __sync_val_compare_and_swap(&value, expected, desired); if (previous == expected) return True; expected = previous; return False; }
+
+				static inline Void			 Fence(MemoryOrder = MemoryOrderSequential)							{ __sync_synchronize(); }
+#elif defined _MSC_VER
+			/* Interlocked operations always imply a full barrier.
+			 */
+			private:
+				template <class t, class i> static inline i	 ToBits(t n)	{ union { t value; i bits; } u; u.bits = 0; u.value = n; return u.bits; }
+				template <class t, class i> static inline t	 FromBits(i n)	{ union { t value; i bits; } u; u.bits = n; return u.value; }
+			public:
+				template <class t> static inline t	 Load(const volatile t &value, MemoryOrder order = MemoryOrderSequential)
+				{
+					typedef AtomicIntrinsics<sizeof(t)> I;
+
+					if (order == MemoryOrderRelaxed) return value;
+
+					return FromBits<t>(I::CompareExchange((volatile typename I::Type *) &value, 0, 0));
+				}
+
+				template <class t> static inline Void	 Store(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)
+				{
+					if (order == MemoryOrderRelaxed) value = n;
+					else				 Exchange(value, n, order);
+				}
+
+				template <class t> static inline t	 Exchange(volatile t &value, t n, MemoryOrder = MemoryOrderSequential)
+				{
+					typedef AtomicIntrinsics<sizeof(t)> I;
+
+					return FromBits<t>(I::Exchange((volatile typename I::Type *) &value, ToBits<t, typename I::Type>(n)));
+				}
+
+				template <class t> static inline t	 FetchAdd(volatile t &value, t n, MemoryOrder = MemoryOrderSequential)
+				{
+					typedef AtomicIntrinsics<sizeof(t)> I;
+
+					return (t) I::Add((volatile typename I::Type *) &value, (typename I::Type) n);
+				}
+
+				template <class t> static inline t	 FetchSub(volatile t &value, t n, MemoryOrder order = MemoryOrderSequential)
+				{
+					return FetchAdd(value, (t) -n, order);
+				}
+
+				template <class t> static inline t	 FetchAnd(volatile t &value, t n, MemoryOrder = MemoryOrderSequential)
+				{
+					typedef AtomicIntrinsics<sizeof(t)> I;
+
+					return (t) I::And((volatile typename I::Type *) &value, (typename I::Type) n);
+				}
+
+				template <class t> static inline t	 FetchOr(volatile t &value, t n, MemoryOrder = MemoryOrderSequential)
+				{
+					typedef AtomicIntrinsics<sizeof(t)> I;
+
+					return (t) I::Or((volatile typename I::Type *) &value, (typename I::Type) n);
+				}
+
+				template <class t> static inline Bool	 CompareExchange(volatile t &value, t &expected, t desired, MemoryOrder = MemoryOrderSequential)
+				{
+					typedef AtomicIntrinsics<sizeof(t)> I;
+
+					typename I::Type	 comparand = ToBits<t, typename I::Type>(expected);
+					typename I::Type	 previous  = I::CompareExchange((volatile typename I::Type *) &value, ToBits<t, typename I::Type>(desired), comparand);
+
+					if (previous == comparand) return True;
+
+					expected = FromBits<t>(previous);
+
+					return False;
+				}
+
+				static inline Void			 Fence(MemoryOrder = MemoryOrderSequential)
+				{
+					volatile long	 barrier = 0;
+
+					_InterlockedExchange(&barrier, 0);
+				}
+#else
+#	error "Atomic operations are not supported by this compiler."
+#endif
+		};
+	};
+};
+
+#endif
@@ -0,0 +1,78 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_RWLOCKPOSIX
+#define H_OBJSMOOTH_RWLOCKPOSIX
+
+namespace smooth
+{
+	namespace Threads
+	{
+		class RWLockPOSIX;
+	};
+};
+
+#include "../rwlockbackend.h"
+
+#include <pthread.h>
+#include <stdint.h>
+
+namespace smooth
+{
+	namespace Threads
+	{
+		const Short	 RWLOCK_POSIX	= 1;
+
+		/* Blocking, writer preferring read/write lock.
+		 *
+		 * Read locks are acquired with a single atomic operation
+		 * as long as no writer is active or waiting. Write locks
+		 * and read locks held by a writer may be nested.
+		 *
+		 * Each read lock and release also updates a small table of
+		 * read locks held by the current thread, which costs a
+		 * thread-local lookup. This is a deliberate trade-off: only
+		 * with this table can a reader tell whether it may nest a
+		 * read lock past a waiting writer without deadlocking.
+		 */
+		class RWLockPOSIX : public RWLockBackend
+		{
+			protected:
+				volatile Int	 state;
+
+				pthread_mutex_t	 mutex;
+				pthread_cond_t	 readersCondition;
+				pthread_cond_t	 writersCondition;
+				pthread_cond_t	 drainCondition;
+
+				Bool		 writerActive;
+
+				Int		 waitingReaders;
+				Int		 waitingWriters;
+
+				volatile intptr_t owner;
+				Int		 ownerDepth;
+
+				Bool		 IsOwner() const;
+
+				Void		 ReleaseRead();
+			public:
+						 RWLockPOSIX();
+						~RWLockPOSIX();
+
+				Bool		 LockForRead();
+				Bool		 LockForWrite();
+
+				Bool		 Release();
+		};
+	};
+};
+
+#endif
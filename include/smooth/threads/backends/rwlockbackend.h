@@ -0,0 +1,75 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#ifndef H_OBJSMOOTH_RWLOCKBACKEND
+#define H_OBJSMOOTH_RWLOCKBACKEND
+
+namespace smooth
+{
+	namespace Threads
+	{
+		class RWLockBackend;
+		class Mutex;
+	};
+};
+
+#include "../../definitions.h"
+
+namespace smooth
+{
+	namespace Threads
+	{
+		const Short	 RWLOCK_NONE = 0;
+
+		class RWLockBackend
+		{
+			private:
+				static RWLockBackend	*(*backend_creator)();
+
+				volatile Int		 readLocked;
+				volatile Int		 writeLocked;
+
+				Mutex			*exclusiveAccessMutex;
+				Mutex			*sharedAccessMutex;
+			protected:
+				Short			 type;
+
+				/* Number of times a thread had to wait
+				 * for a read or write lock.
+				 */
+				volatile Int		 readContention;
+				volatile Int		 writeContention;
+
+				/* Constructor for native backends not
+				 * using the generic implementation.
+				 */
+							 RWLockBackend(Short);
+			public:
+				static Int		 SetBackend(RWLockBackend *(*)());
+
+				static RWLockBackend	*CreateBackendInstance();
+
+							 RWLockBackend();
+				virtual			~RWLockBackend();
+
+				Short			 GetRWLockType() const;
+
+				Int			 GetReadContention() const	{ return readContention; }
+				Int			 GetWriteContention() const	{ return writeContention; }
+
+				virtual Bool		 LockForRead();
+				virtual Bool		 LockForWrite();
+
+				virtual Bool		 Release();
+		};
+	};
+};
+
+#endif
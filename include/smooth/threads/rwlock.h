@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2017 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -15,8 +15,8 @@ namespace smooth
 {
 	namespace Threads
 	{
-		class Mutex;
 		class RWLock;
+		class RWLockBackend;
 	};
 };
 
@@ -29,11 +29,7 @@ namespace smooth
 		class SMOOTHAPI RWLock
 		{
 			private:
-				volatile Int		 readLocked;
-				volatile Int		 writeLocked;
-
-				Mutex			*exclusiveAccessMutex;
-				Mutex			*sharedAccessMutex;
+				RWLockBackend		*backend;
 			public:
 							 RWLock();
 							 RWLock(const RWLock &);
@@ -41,6 +37,14 @@ namespace smooth
 
 				RWLock &operator	 =(const RWLock &);
 
+				Int			 GetRWLockType() const;
+
+				/* Number of times a thread had to wait for
+				 * this lock since it was created.
+				 */
+				Int			 GetReadContention() const;
+				Int			 GetWriteContention() const;
+
 				Bool			 LockForRead();
 				Bool			 LockForWrite();
 
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2015 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -42,7 +42,7 @@ namespace smooth
 				Bool	 ownRoot;
 
 				Int	 LoadNode(xmlTextReaderPtr, Node *);
-				Int	 SaveNode(xmlTextWriterPtr, Node *);
+				Int	 SaveNode(xmlTextWriterPtr, Node *, Buffer<char> &, Buffer<char> &);
 			public:
 					 Document();
 					 Document(const Document &);
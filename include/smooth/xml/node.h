@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2015 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -21,6 +21,7 @@ namespace smooth
 
 #include "../definitions.h"
 #include "../misc/string.h"
+#include "../misc/stringpool.h"
 #include "attribute.h"
 #include "document.h"
 
@@ -31,14 +32,12 @@ namespace smooth
 		class SMOOTHAPI Node
 		{
 			private:
-				static Array<String>		 elementNames;
-
 				Array<Attribute *, Void *>	*attributes;
 				Array<Node *, Void *>		*subnodes;
 
 				Int				 nodeID;
 
-				Int				 nameIndex;
+				const String			*name;
 				String				 content;
 			public:
 								 Node(const String &, const String & = NIL);
@@ -51,6 +50,11 @@ namespace smooth
 				const String			&GetName() const;
 				Int				 SetName(const String &);
 
+				/* Pooled name for comparison by pointer with
+				 * names interned in StringPool::GetGlobal().
+				 */
+				const String			*GetPooledName() const		{ return name; }
+
 				const String			&GetContent() const;
 				Int				 SetContent(const String &);
 
@@ -0,0 +1,155 @@
+ /* The smooth Class Library
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
+  *
+  * This library is free software; you can redistribute it and/or
+  * modify it under the terms of "The Artistic License, Version 2.0".
+  *
+  * THIS PACKAGE IS PROVIDED "AS IS" AND WITHOUT ANY EXPRESS OR
+  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */
+
+#include <smooth.h>
+#include <smooth/main.h>
+
+#include <iconv.h>
+
+using namespace smooth;
+using namespace smooth::System;
+
+/* Compares the built-in string converters against plain iconv
+ * using file name like strings with a few non-ASCII characters.
+ */
+static const Int	 numStrings = 20000;
+static const Int	 numRounds  = 20;
+
+static Void Report(const String &name, UnsignedInt64 bytes, UnsignedInt64 ticks)
+{
+	Int	 rate = ticks > 0 ? bytes / 1024 * 1000 / 1024 / ticks : 0;
+
+	Console::OutputLine(String(name).Append(": ").Append(String::FromInt(ticks)).Append(" ms, ").Append(String::FromInt(rate)).Append(" MB/s"));
+}
+
+Int smooth::Main()
+{
+	/* Generate test strings.
+	 */
+	Array<String>	 strings;
+	Array<char *>	 utf8;
+	UnsignedInt64	 utf8Bytes = 0;
+
+	for (Int i = 0; i < numStrings; i++)
+	{
+		String	 string = String("/home/user/Music/Some Artist - Some Album (").Append(String::FromInt(1990 + i % 30)).Append(")/").Append(String::FromInt(i % 20 + 1)).Append(" - Track Title");
+
+		/* Add a non-ASCII character to every fourth string.
+		 */
+		if (i % 4 == 0) string.Append(" - ").Append(String().FillN(0x00E9 + i % 8, 1)).Append(String().FillN(0x4E00 + i % 64, 1));
+
+		string.Append(".flac");
+
+		char	*buffer = new char [strlen(string.ConvertTo("UTF-8")) + 1];
+
+		strcpy(buffer, string.ConvertTo("UTF-8"));
+
+		strings.Add(string);
+		utf8.Add(buffer);
+
+		utf8Bytes += strlen(buffer);
+	}
+
+	/* Convert UTF-8 to the internal format.
+	 */
+	iconv_t		 toInternal = iconv_open(String::GetInternalFormat(), "UTF-8");
+	Buffer<wchar_t>	 wideBuffer(1024);
+	UnsignedInt64	 start	    = System::System::Clock();
+
+	for (Int n = 0; n < numRounds; n++)
+	{
+		for (Int i = 0; i < numStrings; i++)
+		{
+			char	*in	 = utf8.GetNth(i);
+			size_t	 inSize	 = strlen(in);
+			char	*out	 = (char *) (wchar_t *) wideBuffer;
+			size_t	 outSize = wideBuffer.Size() * sizeof(wchar_t);
+
+			iconv(toInternal, NIL, NIL, NIL, NIL);
+			iconv(toInternal, &in, &inSize, &out, &outSize);
+		}
+	}
+
+	Report("UTF-8 import, iconv", utf8Bytes * numRounds, System::System::Clock() - start);
+
+	iconv_close(toInternal);
+
+	start = System::System::Clock();
+
+	for (Int n = 0; n < numRounds; n++)
+	{
+		String	 string;
+
+		for (Int i = 0; i < numStrings; i++) string.ImportFrom("UTF-8", utf8.GetNth(i));
+	}
+
+	Report("UTF-8 import, String::ImportFrom", utf8Bytes * numRounds, System::System::Clock() - start);
+
+	/* Convert internal format to UTF-8.
+	 */
+	iconv_t		 fromInternal = iconv_open("UTF-8", String::GetInternalFormat());
+	Buffer<char>	 narrowBuffer(4096);
+
+	start = System::System::Clock();
+
+	for (Int n = 0; n < numRounds; n++)
+	{
+		for (Int i = 0; i < numStrings; i++)
+		{
+			const String	&string	 = strings.GetNth(i);
+			char		*in	 = (char *) (wchar_t *) string;
+			size_t		 inSize	 = string.Length() * sizeof(wchar_t);
+			char		*out	 = narrowBuffer;
+			size_t		 outSize = narrowBuffer.Size();
+
+			iconv(fromInternal, NIL, NIL, NIL, NIL);
+			iconv(fromInternal, &in, &inSize, &out, &outSize);
+		}
+	}
+
+	Report("UTF-8 export, iconv", utf8Bytes * numRounds, System::System::Clock() - start);
+
+	iconv_close(fromInternal);
+
+	start = System::System::Clock();
+
+	for (Int n = 0; n < numRounds; n++)
+	{
+		for (Int i = 0; i < numStrings; i++) strings.GetNth(i).ConvertTo("UTF-8");
+	}
+
+	Report("UTF-8 export, String::ConvertTo", utf8Bytes * numRounds, System::System::Clock() - start);
+
+	start = System::System::Clock();
+
+	for (Int n = 0; n < numRounds; n++)
+	{
+		for (Int i = 0; i < numStrings; i++) strings.GetNth(i).ConvertTo("UTF-8", narrowBuffer);
+	}
+
+	Report("UTF-8 export, String::ConvertTo to buffer", utf8Bytes * numRounds, System::System::Clock() - start);
+
+	/* Scan for non-ANSI characters.
+	 */
+	Int	 numUnicode = 0;
+
+	start = System::System::Clock();
+
+	for (Int n = 0; n < numRounds; n++)
+	{
+		for (Int i = 0; i < numStrings; i++) if (String::IsUnicode(strings.GetNth(i))) numUnicode++;
+	}
+
+	Report("Unicode scan, String::IsUnicode", utf8Bytes * numRounds, System::System::Clock() - start);
+
+	for (Int i = 0; i < numStrings; i++) delete [] utf8.GetNth(i);
+
+	return 0;
+}
@@ -1,5 +1,5 @@
  /* The smooth Class Library
-  * Copyright (C) 1998-2019 Robert Kausch <robert.kausch@gmx.net>
+  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>
   *
   * This library is free software; you can redistribute it and/or
   * modify it under the terms of "The Artistic License, Version 2.0".
@@ -13,166 +13,248 @@
 
 using namespace smooth;
 using namespace smooth::IO;
+using namespace smooth::System;
 
-Void generateConversion(Int field, OutStream &out)
+/* smooth strings support only 16 bit values at the moment.
+ */
+static const Int	 numChars   = 65536;
+
+/* Characters are grouped in blocks of 64 sharing
+ * an entry in the first stage table.
+ */
+static const Int	 blockShift = 6;
+static const Int	 blockSize  = 1 << blockShift;
+
+/* Mappings stored per record.
+ */
+static const Int	 numFields  = 4;	// Upper, lower, title and folded case
+
+static Int	 upperCase[numChars];
+static Int	 lowerCase[numChars];
+static Int	 titleCase[numChars];
+
+Bool readMappings()
 {
+	for (Int i = 0; i < numChars; i++)
+	{
+		upperCase[i] = i;
+		lowerCase[i] = i;
+		titleCase[i] = i;
+	}
+
 	InStream	 in(STREAM_FILE, String("UnicodeData.txt"), IS_READ);
 
-	Int	 seriesCount	=  0;
-	Int	 seriesLength	=  0;
-	Int	 seriesType	= -1;
-	Int64	 seriesStart	=  0;
-	Int64	 difference	=  0;
+	if (in.GetLastError() != IO_ERROR_OK) return False;
 
 	while (True)
 	{
-		const Array<String>	&line = in.InputLine().Explode(";");
+		String		 line = in.InputLine();
+		StringTokenizer	 tokenizer(line, ";");
+		StringView	 field[15];
+		Int		 nOfFields = 0;
 
 		/* Exit if no more data is found.
 		 */
-		if (line.Length() == 0) break;
+		if (line == NIL) break;
 
-		Int	 hexVal = (Int64) Number::FromHexString(line.GetFirst());
-		Int	 hexLower = (Int64) Number::FromHexString(line.GetNth(field));
+		while (nOfFields < 15 && tokenizer.Next(field[nOfFields])) nOfFields++;
 
-		/* Continue if we are in the middle of a special letters series.
-		 */
-		if (Math::Abs(difference) == 1 && hexVal < (seriesStart + (seriesLength * 2)) && line.GetNth(field) == NIL) continue;
+		Int	 value = (Int64) Number::FromHexString(field[0].ToString());
+
+		if (value >= numChars) continue;
+
+		if (nOfFields > 12 && field[12].Length() > 0) upperCase[value] = (Int64) Number::FromHexString(field[12].ToString());
+		if (nOfFields > 13 && field[13].Length() > 0) lowerCase[value] = (Int64) Number::FromHexString(field[13].ToString());
+		if (nOfFields > 14 && field[14].Length() > 0) titleCase[value] = (Int64) Number::FromHexString(field[14].ToString());
+	}
+
+	in.Close();
+
+	return True;
+}
+
+Void outputTable(OutStream &out, const String &declaration, const Array<Int> &values, Int perLine, Int hexDigits, Int perGroup = 1)
+{
+	StringBuilder	 builder;
+
+	builder.Append("\t").Append(declaration).Append(" =\n\t{");
+
+	for (Int i = 0; i < values.Length(); i++)
+	{
+		if	(i % (perLine * perGroup) == 0) builder.Append("\n\t\t");
+		else if (i % perGroup		  == 0) builder.AppendChar(' ');
+
+		if (perGroup > 1 && i % perGroup == 0) builder.Append("{ ");
+
+		if (hexDigits > 0) builder.Append("0x").Append(Number((Int64) values.GetNth(i)).ToHexString(hexDigits));
+		else		   builder.Append(values.GetNth(i));
+
+		if (perGroup > 1 && i % perGroup == perGroup - 1) builder.Append(" }");
+
+		if	(i < values.Length() - 1 && i % perGroup == perGroup - 1) builder.AppendChar(',');
+		else if (i < values.Length() - 1)				  builder.Append(", ");
+	}
+
+	builder.Append("\n\t};\n\n");
+
+	out.OutputString(builder.Finish());
+}
+
+Int smooth::Main()
+{
+	if (!readMappings())
+	{
+		Console::OutputLine("Unable to read UnicodeData.txt.");
+
+		return -1;
+	}
 
-		if (seriesLength > 0 && (line.GetNth(field) == NIL || hexLower - hexVal != difference))
+	/* Collect distinct delta records.
+	 */
+	Array<Int>	 records;
+	Array<Int>	 recordIndex;
+
+	for (Int c = 0; c < numChars; c++)
+	{
+		Int	 delta[numFields] = { upperCase[c] - c, lowerCase[c] - c, titleCase[c] - c, lowerCase[upperCase[c]] - c };
+		Int	 index = -1;
+
+		for (Int r = 0; r < records.Length() / numFields && index == -1; r++)
 		{
-			if (seriesCount != 0) out.OutputString("\r\n\t\telse ");
-			else		      out.OutputString("\r\n\t\t");
-
-			if (seriesLength == 1)
-			{
-				out.OutputString(String("if\t(value == 0x").Append(Number(seriesStart).ToHexString()).Append(")"));
-				out.OutputString("\t\t\t\t\t");
-				out.OutputString(String("retVal[i] =\t    0x").Append(Number(seriesStart + difference).ToHexString()).Append(";\t// Single character"));
-			}
-			else if (seriesType == 0)
-			{
-				out.OutputString(String("if\t(value >= 0x").Append(Number(seriesStart).ToHexString()).Append(" && value <= 0x").Append(Number(seriesStart + seriesLength - 1).ToHexString()).Append(")"));
-				out.OutputString("\t\t\t");
-				out.OutputString(String("retVal[i] = value ").Append(difference >= 0 ? "+" : "-").Append(" 0x"));
-				out.OutputString(Number(Math::Abs(difference)).ToHexString().Append(";\t// Alphabet"));
-			}
-			else if (seriesType == 1)
-			{
-				out.OutputString(String("if\t(value >= 0x").Append(Number(seriesStart).ToHexString()).Append(" && value <= 0x").Append(Number(seriesStart + 2 * (seriesLength - 1)).ToHexString()).Append(" && ").Append(seriesStart & 1 ? " " : "!").Append("(value & 1)").Append(")"));
-				out.OutputString("\t");
-				out.OutputString(String("retVal[i] = value ").Append(difference >= 0 ? "+" : "-").Append(" 0x"));
-				out.OutputString(Number(Math::Abs(difference)).ToHexString().Append(";\t// Special letters"));
-			}
-
-			seriesCount++;
-			seriesLength	=  0;
-			seriesType	= -1;
-			seriesStart	=  0;
-			difference	=  0;
+			Bool	 equal = True;
+
+			for (Int f = 0; f < numFields; f++) if (records.GetNth(r * numFields + f) != delta[f]) equal = False;
+
+			if (equal) index = r;
 		}
 
-		/* smooth strings support only 16 bit values at the moment.
-		 */
-		if (hexVal >= 65536) continue;
+		if (index == -1)
+		{
+			index = records.Length() / numFields;
+
+			for (Int f = 0; f < numFields; f++) records.Add(delta[f]);
+		}
 
-		if (line.GetNth(field) != NIL)
+		recordIndex.Add(index);
+	}
+
+	/* Share identical blocks of record indices.
+	 */
+	Array<Int>	 stage1;
+	Array<Int>	 stage2;
+
+	for (Int b = 0; b < numChars / blockSize; b++)
+	{
+		Int	 block = -1;
+
+		for (Int s = 0; s < stage2.Length() / blockSize && block == -1; s++)
 		{
-			if (seriesLength == 0)
-			{
-				difference = hexLower - hexVal;
-				seriesStart = hexVal;
+			Bool	 equal = True;
+
+			for (Int i = 0; i < blockSize && equal; i++) if (stage2.GetNth(s * blockSize + i) != recordIndex.GetNth(b * blockSize + i)) equal = False;
+
+			if (equal) block = s;
+		}
 
-				if (Math::Abs(difference) == 1) seriesType = 1;
-				else				seriesType = 0;
-			}
+		if (block == -1)
+		{
+			block = stage2.Length() / blockSize;
 
-			seriesLength++;
+			for (Int i = 0; i < blockSize; i++) stage2.Add(recordIndex.GetNth(b * blockSize + i));
 		}
+
+		stage1.Add(block);
 	}
 
-	in.Close();
-}
+	if (records.Length() / numFields > 256 || stage2.Length() / blockSize > 256)
+	{
+		Console::OutputLine("Too many records or blocks for 8 bit indices.");
 
-Int smooth::Main()
-{
+		return -1;
+	}
+
+	/* Write tables and conversion functions.
+	 */
 	OutStream	 out(STREAM_FILE, String("string_case.cpp"), OS_REPLACE);
 
-	out.OutputString(" /* The smooth Class Library						\
-		\r\n  * Copyright (C) 1998-2015 Robert Kausch <robert.kausch@gmx.net>		\
-		\r\n  *										\
-		\r\n  * This library is free software; you can redistribute it and/or		\
-		\r\n  * modify it under the terms of \"The Artistic License, Version 2.0\".	\
-		\r\n  *										\
-		\r\n  * THIS PACKAGE IS PROVIDED \"AS IS\" AND WITHOUT ANY EXPRESS OR		\
-		\r\n  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED		\
-		\r\n  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */	\
-		\r\n										\
-		\r\n#include <smooth/misc/string.h>						\
-		\r\n										\
-		\r\nS::String S::String::ToUpper() const					\
-		\r\n{										\
-		\r\n	String	 retVal = *this;						\
-		\r\n	Int	 length = Length();						\
-		\r\n										\
-		\r\n	for (Int i = 0; i < length; i++)					\
-		\r\n	{									\
-		\r\n		Int	 value = (*this)[i];					\
-		\r\n");
-
-	generateConversion(12, out);	// To upper case
-
-	out.OutputString("					\
-								\
-		\r\n	}					\
-		\r\n						\
-		\r\n	return retVal;				\
-		\r\n}						\
-		\r\n");
-
-	out.OutputString("					\
-								\
-		\r\nS::String S::String::ToLower() const	\
-		\r\n{						\
-		\r\n	String	 retVal = *this;		\
-		\r\n	Int	 length = Length();		\
-		\r\n						\
-		\r\n	for (Int i = 0; i < length; i++)	\
-		\r\n	{					\
-		\r\n		Int	 value = (*this)[i];	\
-		\r\n");
-
-	generateConversion(13, out);	// To lower case
-
-	out.OutputString("					\
-								\
-		\r\n	}					\
-		\r\n						\
-		\r\n	return retVal;				\
-		\r\n}						\
-		\r\n");
-
-	out.OutputString("					\
-								\
-		\r\nS::String S::String::ToTitle() const	\
-		\r\n{						\
-		\r\n	String	 retVal = *this;		\
-		\r\n	Int	 length = Length();		\
-		\r\n						\
-		\r\n	for (Int i = 0; i < length; i++)	\
-		\r\n	{					\
-		\r\n		Int	 value = (*this)[i];	\
-		\r\n");
-
-	generateConversion(14, out);	// To title case
-
-	out.OutputString("					\
-								\
-		\r\n	}					\
-		\r\n						\
-		\r\n	return retVal;				\
-		\r\n}						\
-		\r\n");
+	out.OutputString(" /* The smooth Class Library\n"
+			 "  * Copyright (C) 1998-2026 Robert Kausch <robert.kausch@gmx.net>\n"
+			 "  *\n"
+			 "  * This library is free software; you can redistribute it and/or\n"
+			 "  * modify it under the terms of \"The Artistic License, Version 2.0\".\n"
+			 "  *\n"
+			 "  * THIS PACKAGE IS PROVIDED \"AS IS\" AND WITHOUT ANY EXPRESS OR\n"
+			 "  * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED\n"
+			 "  * WARRANTIES OF MERCHANTIBILITY AND FITNESS FOR A PARTICULAR PURPOSE. */\n"
+			 "\n"
+			 "/* This file is generated by tools/gencaseconv from UnicodeData.txt.\n"
+			 " */\n"
+			 "\n"
+			 "#include <smooth/misc/string.h>\n"
+			 "\n"
+			 "#include \"string_internal.h\"\n"
+			 "\n"
+			 "namespace smooth\n"
+			 "{\n"
+			 "\t/* Case mapping deltas for the Basic Multilingual Plane.\n"
+			 "\t *\n"
+			 "\t * The first stage maps blocks of 64 characters to shared blocks\n"
+			 "\t * in the second stage, which hold an index into the records of\n"
+			 "\t * upper, lower, title and folded case deltas for each character.\n"
+			 "\t */\n");
+
+	outputTable(out, String("static const Int32\t\t caseRecords[").Append(String::FromInt(records.Length() / numFields)).Append("][4]"), records, 4, 0, numFields);
+	outputTable(out, String("static const UnsignedByte\t caseStage1[").Append(String::FromInt(stage1.Length())).Append("]"), stage1, 16, 2);
+	outputTable(out, String("static const UnsignedByte\t caseStage2[").Append(String::FromInt(stage2.Length())).Append("]"), stage2, 16, 2);
+
+	out.OutputString("\twchar_t MapCase(wchar_t c, Int mapping)\n"
+			 "\t{\n"
+			 "\t\tif ((UnsignedInt32) c >= 65536) return c;\n"
+			 "\n"
+			 "\t\treturn c + caseRecords[caseStage2[(caseStage1[c >> 6] << 6) | (c & 63)]][mapping];\n"
+			 "\t}\n"
+			 "\n"
+			 "\t/* Map a run of characters, converting ASCII characters\n"
+			 "\t * with the vectorized kernel from string_simd.cpp.\n"
+			 "\t */\n"
+			 "\tVoid MapCase(const wchar_t *in, wchar_t *out, Int count, Int mapping)\n"
+			 "\t{\n"
+			 "\t\twchar_t\t first = (mapping == CASE_LOWER || mapping == CASE_FOLD ? 'A' : 'a');\n"
+			 "\n"
+			 "\t\tfor (Int i = 0; i < count; i++)\n"
+			 "\t\t{\n"
+			 "\t\t\tif ((UnsignedInt32) in[i] < 0x80) i += CaseASCII(in + i, out + i, count - i, first) - 1;\n"
+			 "\t\t\telse\t\t\t\t  out[i] = MapCase(in[i], mapping);\n"
+			 "\t\t}\n"
+			 "\t}\n"
+			 "};\n");
+
+	const char	*methods[] = { "ToUpper", "ToLower", "ToTitle", NIL };
+	const char	*mappings[] = { "CASE_UPPER", "CASE_LOWER", "CASE_TITLE", NIL };
+
+	for (Int i = 0; methods[i] != NIL; i++)
+	{
+		StringBuilder	 method;
+
+		method.Append("\nS::String S::String::").Append(methods[i]).Append("() const\n"
+			      "{\n"
+			      "\tInt\t length = Length();\n"
+			      "\tString\t retVal;\n"
+			      "\n"
+			      "\tif (length == 0) return retVal;\n"
+			      "\n"
+			      "\tretVal.wString.Resize(length + 1);\n"
+			      "\n"
+			      "\tMapCase(wString, retVal.wString, length, ").Append(mappings[i]).Append(");\n"
+			      "\n"
+			      "\tretVal.wString[length] = 0;\n"
+			      "\tretVal.stringLength    = length;\n"
+			      "\n"
+			      "\treturn retVal;\n"
+			      "}\n");
+
+		out.OutputString(method.Finish());
+	}
 
 	out.Close();
 